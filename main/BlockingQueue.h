@@ -0,0 +1,318 @@
+#ifndef BLOCKING_QUEUE_H
+#define BLOCKING_QUEUE_H
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <type_traits>
+#include "CacheLine.h"
+
+enum
+{
+	// Failed attempts before a blocking call parks the thread
+	BLOCKING_QUEUE_SPINS = 64
+};
+
+// Bounded multi-producer multi-consumer queue that applies backpressure: producers wait while it is full.
+// Every cell carries a sequence number that tells producers and consumers whose turn it is (Vyukov's bounded queue),
+// so the non-blocking paths take a single CAS and never lock. Blocking calls spin briefly and then park on a condition variable,
+// which is only notified when a thread is actually parked.
+template <typename T>
+class BlockingQueue
+{
+	static_assert(!std::is_pointer_v<T>, "Attempted to make a BlockingQueue with a raw pointer type");
+
+	struct Cell
+	{
+		std::atomic<size_t> sequence;
+		union
+		{
+			T data;
+		};
+
+		Cell() : sequence(0) {}
+
+		~Cell() {}
+	};
+
+	using Clock = std::chrono::steady_clock;
+
+public:
+	// The capacity is rounded up to a power of two
+	explicit BlockingQueue(const size_t capacity) : mask_(round_capacity(capacity) - 1), cells_(new Cell[mask_ + 1]), enqueue_pos_(0), dequeue_pos_(0),
+	                                                waiting_producers_(0), waiting_consumers_(0), closed_(false)
+	{
+		for(size_t i = 0; i <= mask_; i++)
+			cells_[i].sequence.store(i, std::memory_order_relaxed);
+	}
+
+	~BlockingQueue()
+	{
+		const size_t end = enqueue_pos_.load(std::memory_order_relaxed);
+		for(size_t i = dequeue_pos_.load(std::memory_order_relaxed); i != end; i++)
+			cells_[i & mask_].data.~T();
+		delete[] cells_;
+	}
+
+	// Other threads could be parked on this queue, so it can not be copied or moved
+	BlockingQueue(const BlockingQueue& other) = delete;
+	BlockingQueue& operator=(const BlockingQueue& other) = delete;
+	BlockingQueue(BlockingQueue&& other) = delete;
+	BlockingQueue& operator=(BlockingQueue&& other) = delete;
+
+	// Returns false when the queue is full or closed, the element is only moved from on success
+	bool try_push(const T& data)
+	{
+		return try_emplace(data);
+	}
+
+	bool try_push(T&& data)
+	{
+		return try_emplace(std::move(data));
+	}
+
+	template <typename... Args>
+	bool try_emplace(Args&&... args)
+	{
+		if(!enqueue(std::forward<Args>(args)...)) return false;
+		wake(waiting_consumers_, not_empty_);
+		return true;
+	}
+
+	// Waits while the queue is full, returns false when the queue is closed
+	bool push(const T& data)
+	{
+		return wait_until([&] { return enqueue(data); }, waiting_producers_, not_full_, waiting_consumers_, not_empty_, nullptr);
+	}
+
+	bool push(T&& data)
+	{
+		return wait_until([&] { return enqueue(std::move(data)); }, waiting_producers_, not_full_, waiting_consumers_, not_empty_, nullptr);
+	}
+
+	template <typename... Args>
+	bool emplace(Args&&... args)
+	{
+		return wait_until([&] { return enqueue(std::forward<Args>(args)...); }, waiting_producers_, not_full_, waiting_consumers_, not_empty_, nullptr);
+	}
+
+	// Waits at most timeout while the queue is full, returns false on timeout or when the queue is closed
+	template <typename Rep, typename Period>
+	bool push_for(const T& data, const std::chrono::duration<Rep, Period>& timeout)
+	{
+		const Clock::time_point deadline = Clock::now() + timeout;
+		return wait_until([&] { return enqueue(data); }, waiting_producers_, not_full_, waiting_consumers_, not_empty_, &deadline);
+	}
+
+	template <typename Rep, typename Period>
+	bool push_for(T&& data, const std::chrono::duration<Rep, Period>& timeout)
+	{
+		const Clock::time_point deadline = Clock::now() + timeout;
+		return wait_until([&] { return enqueue(std::move(data)); }, waiting_producers_, not_full_, waiting_consumers_, not_empty_, &deadline);
+	}
+
+	// Moves the front element into out, returns false when the queue is empty
+	bool try_pop(T& out)
+	{
+		if(!dequeue(out)) return false;
+		wake(waiting_producers_, not_full_);
+		return true;
+	}
+
+	// Waits while the queue is empty, returns false once the queue is closed and drained
+	bool pop(T& out)
+	{
+		return wait_until([&] { return dequeue(out); }, waiting_consumers_, not_empty_, waiting_producers_, not_full_, nullptr);
+	}
+
+	// Waits at most timeout while the queue is empty, returns false on timeout or once the queue is closed and drained
+	template <typename Rep, typename Period>
+	bool pop_for(T& out, const std::chrono::duration<Rep, Period>& timeout)
+	{
+		const Clock::time_point deadline = Clock::now() + timeout;
+		return wait_until([&] { return dequeue(out); }, waiting_consumers_, not_empty_, waiting_producers_, not_full_, &deadline);
+	}
+
+	// Makes every following push fail and wakes all parked threads, consumers can still drain the remaining elements
+	void close()
+	{
+		closed_.store(true, std::memory_order_release);
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+		}
+		not_full_.notify_all();
+		not_empty_.notify_all();
+	}
+
+	[[nodiscard]] bool is_closed() const noexcept
+	{
+		return closed_.load(std::memory_order_acquire);
+	}
+
+	// Only a snapshot, other threads may change the queue right after
+	[[nodiscard]] size_t size() const noexcept
+	{
+		const size_t head = dequeue_pos_.load(std::memory_order_acquire);
+		const size_t tail = enqueue_pos_.load(std::memory_order_acquire);
+		return tail > head ? tail - head : 0;
+	}
+
+	[[nodiscard]] bool empty() const noexcept
+	{
+		return size() == 0;
+	}
+
+	[[nodiscard]] size_t capacity() const noexcept
+	{
+		return mask_ + 1;
+	}
+
+private:
+	const size_t mask_;
+	Cell* const cells_;
+	alignas(CACHE_LINE_SIZE) std::atomic<size_t> enqueue_pos_;
+	alignas(CACHE_LINE_SIZE) std::atomic<size_t> dequeue_pos_;
+	alignas(CACHE_LINE_SIZE) std::atomic<size_t> waiting_producers_;
+	std::atomic<size_t> waiting_consumers_;
+	std::atomic<bool> closed_;
+	std::mutex mutex_;
+	std::condition_variable not_full_;
+	std::condition_variable not_empty_;
+
+	static size_t round_capacity(const size_t capacity) noexcept
+	{
+		size_t res = 2;
+		while(res < capacity)
+			res *= 2;
+		return res;
+	}
+
+	template <typename... Args>
+	bool enqueue(Args&&... args)
+	{
+		if(closed_.load(std::memory_order_acquire)) return false;
+
+		size_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+		Cell* cell;
+		while(true)
+		{
+			cell = &cells_[pos & mask_];
+			const size_t sequence = cell->sequence.load(std::memory_order_acquire);
+			const auto diff = static_cast<std::ptrdiff_t>(sequence - pos);
+			if(diff == 0)
+			{
+				if(enqueue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+			}
+			else if(diff < 0)
+				return false;
+			else
+				pos = enqueue_pos_.load(std::memory_order_relaxed);
+		}
+
+		new(&cell->data) T(std::forward<Args>(args)...);
+		cell->sequence.store(pos + 1, std::memory_order_release);
+		return true;
+	}
+
+	bool dequeue(T& out)
+	{
+		size_t pos = dequeue_pos_.load(std::memory_order_relaxed);
+		Cell* cell;
+		while(true)
+		{
+			cell = &cells_[pos & mask_];
+			const size_t sequence = cell->sequence.load(std::memory_order_acquire);
+			const auto diff = static_cast<std::ptrdiff_t>(sequence - (pos + 1));
+			if(diff == 0)
+			{
+				if(dequeue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+			}
+			else if(diff < 0)
+				return false;
+			else
+				pos = dequeue_pos_.load(std::memory_order_relaxed);
+		}
+
+		out = std::move(cell->data);
+		cell->data.~T();
+		cell->sequence.store(pos + mask_ + 1, std::memory_order_release);
+		return true;
+	}
+
+	// Waits until attempt succeeds, the queue is closed or the deadline passes, a success wakes a thread parked on the other side
+	template <typename Attempt>
+	bool wait_until(Attempt attempt, std::atomic<size_t>& waiting, std::condition_variable& cond,
+	                std::atomic<size_t>& otherWaiting, std::condition_variable& otherCond, const Clock::time_point* deadline)
+	{
+		if(!park_until(attempt, waiting, cond, deadline)) return false;
+
+		// Has to happen after the lock taken by park_until is released, wake takes it again
+		wake(otherWaiting, otherCond);
+		return true;
+	}
+
+	// Spins on attempt for a while, then parks on cond
+	template <typename Attempt>
+	bool park_until(Attempt& attempt, std::atomic<size_t>& waiting, std::condition_variable& cond, const Clock::time_point* deadline)
+	{
+		for(size_t i = 0; i < BLOCKING_QUEUE_SPINS; i++)
+		{
+			const bool closed = closed_.load(std::memory_order_acquire);
+			if(attempt()) return true;
+			if(closed) return false;
+			if(i >= BLOCKING_QUEUE_SPINS / 2)
+				std::this_thread::yield();
+		}
+
+		std::unique_lock<std::mutex> lock(mutex_);
+		waiting.fetch_add(1, std::memory_order_seq_cst);
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		bool res;
+		while(true)
+		{
+			// Read closed before the attempt, an element pushed right before closing must still be popped
+			const bool closed = closed_.load(std::memory_order_acquire);
+			if(attempt())
+			{
+				res = true;
+				break;
+			}
+			if(closed)
+			{
+				res = false;
+				break;
+			}
+
+			if(deadline == nullptr)
+				cond.wait(lock);
+			else if(cond.wait_until(lock, *deadline) == std::cv_status::timeout)
+			{
+				res = attempt();
+				// This thread may have swallowed a notification meant for another parked thread, pass it on
+				if(!res)
+					cond.notify_one();
+				break;
+			}
+		}
+		waiting.fetch_sub(1, std::memory_order_relaxed);
+		return res;
+	}
+
+	// Only takes the lock when a thread is parked, the lock makes sure the notification can not slip in before it waits
+	void wake(std::atomic<size_t>& waiting, std::condition_variable& cond)
+	{
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		if(waiting.load(std::memory_order_relaxed) == 0) return;
+
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+		}
+		cond.notify_one();
+	}
+};
+
+#endif // BLOCKING_QUEUE_H
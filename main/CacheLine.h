@@ -0,0 +1,11 @@
+#ifndef CACHE_LINE_H
+#define CACHE_LINE_H
+
+// Alignment used to keep independently written atomics on separate cache lines.
+// std::hardware_destructive_interference_size is not used because its value may differ between compilers.
+enum
+{
+	CACHE_LINE_SIZE = 64
+};
+
+#endif // CACHE_LINE_H
@@ -0,0 +1,225 @@
+#ifndef CONCURRENT_HASH_MAP_H
+#define CONCURRENT_HASH_MAP_H
+
+#include <bit>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <utility>
+#include "CacheLine.h"
+#include "Hashing.h"
+#include "SwissTable.h"
+#include "RobinHoodTable.h"
+#include "TypeTraitsCheck.h"
+
+enum
+{
+	CONCURRENT_HASH_MAP_SHARDS = 64
+};
+
+// Thread safe map that splits its keys over independently locked shards, each one an ordinary table behind a reader-writer lock.
+// Threads working on different shards never touch the same lock, and every shard sits on its own cache lines
+// so that taking one lock does not invalidate its neighbours. Each shard grows on its own, a resize only blocks the keys of that shard.
+// Nothing hands out references into the map, values are copied out or seen by a visitor while the shard is locked.
+template <typename T, typename U, typename Layout = SwissLayout, typename Hash = DefaultHash<T>>
+class ConcurrentHashMap
+{
+	static_assert(std::is_copy_constructible_v<T>, "Attempted to make a ConcurrentHashMap with a type that does not implement a copy constructor");
+	static_assert(!std::is_pointer_v<T>, "Attempted to make a ConcurrentHashMap with a raw pointer type");
+	static_assert(is_equatable<T>::value, "Attempted to make a ConcurrentHashMap with a key type that does not have the '==' operator implemented");
+	static_assert(is_hash_for<Hash, T>::value, "The hash of this ConcurrentHashMap can not hash its key type, std::hash<T> may not be specialized for it");
+
+	struct Entry
+	{
+		T key;
+		U value;
+
+		template <typename K, typename... Args> requires(!std::is_same_v<std::remove_cvref_t<K>, Entry>)
+		explicit Entry(K&& key, Args&&... args) : key(std::forward<K>(key)), value(std::forward<Args>(args)...) {}
+	};
+
+	struct KeyOf
+	{
+		static const T& get(const Entry& entry) noexcept
+		{
+			return entry.key;
+		}
+	};
+
+	using Table = typename Layout::template Table<T, Entry, KeyOf, Hash, std::equal_to<>>;
+
+	struct alignas(CACHE_LINE_SIZE) Shard
+	{
+		mutable std::shared_mutex lock;
+		Table table;
+	};
+
+public:
+	// The shard count is rounded up to a power of two, a few times the number of threads keeps collisions on a lock rare
+	explicit ConcurrentHashMap(const size_t shards = CONCURRENT_HASH_MAP_SHARDS)
+		: shard_mask_(std::bit_ceil(shards == 0 ? size_t(1) : shards) - 1), shards_(std::make_unique<Shard[]>(shard_mask_ + 1)) {}
+
+	~ConcurrentHashMap() = default;
+
+	// Other threads could hold a shard lock, so the map can not be copied or moved
+	ConcurrentHashMap(const ConcurrentHashMap& other) = delete;
+	ConcurrentHashMap& operator=(const ConcurrentHashMap& other) = delete;
+	ConcurrentHashMap(ConcurrentHashMap&& other) = delete;
+	ConcurrentHashMap& operator=(ConcurrentHashMap&& other) = delete;
+
+	// Leaves an existing value alone, returns whether the key was inserted
+	bool insert(const T& key, U value)
+	{
+		Shard& shard = shard_of(key);
+		std::unique_lock lock(shard.lock);
+		return shard.table.try_emplace(key, key, std::move(value)).second;
+	}
+
+	// Overwrites an existing value, returns whether the key was inserted
+	bool insert_or_assign(const T& key, U value)
+	{
+		Shard& shard = shard_of(key);
+		std::unique_lock lock(shard.lock);
+		auto [entry, inserted] = shard.table.try_emplace(key, key, std::move(value));
+		if(!inserted)
+			entry->value = std::move(value);
+		return inserted;
+	}
+
+	// Returns a copy of the value, the map may have changed again by the time it is used
+	[[nodiscard]] std::optional<U> find(const T& key) const
+	{
+		const Shard& shard = shard_of(key);
+		std::shared_lock lock(shard.lock);
+		const Entry* entry = shard.table.find(key);
+		return entry == nullptr ? std::nullopt : std::optional<U>(entry->value);
+	}
+
+	// Calls function with the value while the shard is read locked, so it must not call back into the map.
+	// Returns whether key was found
+	template <typename Function>
+	bool find(const T& key, Function function) const
+	{
+		const Shard& shard = shard_of(key);
+		std::shared_lock lock(shard.lock);
+		const Entry* entry = shard.table.find(key);
+		if(entry == nullptr) return false;
+		function(entry->value);
+		return true;
+	}
+
+	// Calls function with a mutable value while the shard is write locked, returns whether key was found
+	template <typename Function>
+	bool update(const T& key, Function function)
+	{
+		Shard& shard = shard_of(key);
+		std::unique_lock lock(shard.lock);
+		Entry* entry = shard.table.find(key);
+		if(entry == nullptr) return false;
+		function(entry->value);
+		return true;
+	}
+
+	// Returns the value of key, calling factory to create it only when key is missing.
+	// Concurrent callers for the same key call factory once between them
+	template <typename Factory>
+	U compute_if_absent(const T& key, Factory factory)
+	{
+		Shard& shard = shard_of(key);
+		{
+			std::shared_lock lock(shard.lock);
+			if(const Entry* entry = shard.table.find(key)) return entry->value;
+		}
+		std::unique_lock lock(shard.lock);
+		if(const Entry* entry = shard.table.find(key)) return entry->value;
+		return shard.table.try_emplace(key, key, factory()).first->value;
+	}
+
+	[[nodiscard]] bool contains(const T& key) const
+	{
+		const Shard& shard = shard_of(key);
+		std::shared_lock lock(shard.lock);
+		return shard.table.find(key) != nullptr;
+	}
+
+	// Returns whether key was in the map
+	bool erase(const T& key)
+	{
+		Shard& shard = shard_of(key);
+		std::unique_lock lock(shard.lock);
+		return shard.table.erase(key);
+	}
+
+	// Visits every entry one shard at a time, entries added or removed meanwhile in other shards may or may not be seen
+	template <typename Function>
+	void for_each(Function function) const
+	{
+		for(size_t i = 0; i <= shard_mask_; i++)
+		{
+			std::shared_lock lock(shards_[i].lock);
+			shards_[i].table.for_each([&](const Entry& entry)
+			{
+				function(entry.key, entry.value);
+			});
+		}
+	}
+
+	// Spreads room for count entries over the shards
+	void reserve(const size_t count)
+	{
+		const size_t perShard = count / (shard_mask_ + 1) + 1;
+		for(size_t i = 0; i <= shard_mask_; i++)
+		{
+			std::unique_lock lock(shards_[i].lock);
+			shards_[i].table.reserve(perShard);
+		}
+	}
+
+	void clear()
+	{
+		for(size_t i = 0; i <= shard_mask_; i++)
+		{
+			std::unique_lock lock(shards_[i].lock);
+			shards_[i].table.clear();
+		}
+	}
+
+	// Sum over the shards, which is only exact while no other thread changes the map
+	[[nodiscard]] size_t size() const
+	{
+		size_t size = 0;
+		for(size_t i = 0; i <= shard_mask_; i++)
+		{
+			std::shared_lock lock(shards_[i].lock);
+			size += shards_[i].table.size();
+		}
+		return size;
+	}
+
+	[[nodiscard]] bool empty() const
+	{
+		return size() == 0;
+	}
+
+	[[nodiscard]] size_t shard_count() const noexcept
+	{
+		return shard_mask_ + 1;
+	}
+
+private:
+	size_t shard_mask_;
+	std::unique_ptr<Shard[]> shards_;
+	Hash hash_;
+
+	// The tables index by the low bits of the mixed hash, so shards are picked by the high ones
+	Shard& shard_of(const T& key) const noexcept
+	{
+		const size_t hash = table_hash(hash_, key);
+		return shards_[(hash >> (std::numeric_limits<size_t>::digits / 2)) & shard_mask_];
+	}
+};
+
+#endif // CONCURRENT_HASH_MAP_H
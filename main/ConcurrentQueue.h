@@ -0,0 +1,226 @@
+#ifndef CONCURRENT_QUEUE_H
+#define CONCURRENT_QUEUE_H
+
+#include <atomic>
+#include <new>
+#include <type_traits>
+#include "CacheLine.h"
+#include "HazardPointers.h"
+
+enum
+{
+	// Maximum amount of free nodes every thread keeps around for reuse
+	QUEUE_NODE_POOL_SIZE = 1024
+};
+
+// Lock-free Michael-Scott queue, any amount of threads may push and pop at the same time.
+// Unlike Queue, popping an empty queue is not an error, try_pop just reports that nothing was there.
+// Dequeued nodes are reclaimed through HazardPointers and then kept in a per thread pool, so steady traffic barely allocates.
+template <typename T>
+class ConcurrentQueue
+{
+	static_assert(!std::is_pointer_v<T>, "Attempted to make a ConcurrentQueue with a raw pointer type");
+
+	struct Node
+	{
+		std::atomic<Node*> next;
+		// Only alive while the node is queued behind the dummy, the dummy itself never holds an element
+		union
+		{
+			T data;
+		};
+
+		Node() : next(nullptr) {}
+
+		~Node() {}
+	};
+
+	struct NodePool
+	{
+		Node* head = nullptr;
+		size_t size = 0;
+
+		~NodePool()
+		{
+			destroyed() = true;
+			while(head != nullptr)
+			{
+				Node* next = head->next.load(std::memory_order_relaxed);
+				delete head;
+				head = next;
+			}
+		}
+
+		// Hazard pointers may hand back nodes while thread locals are being destroyed, this flag outlives the pool
+		static bool& destroyed() noexcept
+		{
+			thread_local bool flag = false;
+			return flag;
+		}
+	};
+
+public:
+	ConcurrentQueue()
+	{
+		Node* dummy = new Node();
+		head_.store(dummy, std::memory_order_relaxed);
+		tail_.store(dummy, std::memory_order_relaxed);
+	}
+
+	~ConcurrentQueue()
+	{
+		Node* current = head_.load(std::memory_order_relaxed);
+		Node* next = current->next.load(std::memory_order_relaxed);
+		delete current;
+		while(next != nullptr)
+		{
+			current = next;
+			next = current->next.load(std::memory_order_relaxed);
+			current->data.~T();
+			delete current;
+		}
+	}
+
+	// Other threads could hold on to nodes of this queue, so it can not be copied or moved
+	ConcurrentQueue(const ConcurrentQueue& other) = delete;
+	ConcurrentQueue& operator=(const ConcurrentQueue& other) = delete;
+	ConcurrentQueue(ConcurrentQueue&& other) = delete;
+	ConcurrentQueue& operator=(ConcurrentQueue&& other) = delete;
+
+	void push(const T& data)
+	{
+		emplace(data);
+	}
+
+	void push(T&& data)
+	{
+		emplace(std::move(data));
+	}
+
+	template <typename... Args>
+	void emplace(Args&&... args)
+	{
+		Node* node = allocate_node();
+		try
+		{
+			new(&node->data) T(std::forward<Args>(args)...);
+		}
+		catch(...)
+		{
+			// The node was never shared, it can go straight back to the pool
+			recycle_node(node);
+			throw;
+		}
+
+		while(true)
+		{
+			Node* tail = HazardPointers::protect(0, tail_);
+			Node* next = tail->next.load(std::memory_order_acquire);
+			if(tail != tail_.load(std::memory_order_acquire)) continue;
+
+			if(next != nullptr)
+			{
+				// Another push linked its node but did not swing the tail yet, help it along
+				tail_.compare_exchange_weak(tail, next, std::memory_order_release, std::memory_order_relaxed);
+				continue;
+			}
+
+			if(tail->next.compare_exchange_weak(next, node, std::memory_order_release, std::memory_order_relaxed))
+			{
+				tail_.compare_exchange_strong(tail, node, std::memory_order_release, std::memory_order_relaxed);
+				HazardPointers::clear(0);
+				return;
+			}
+		}
+	}
+
+	// Moves the front element into out, returns false without blocking when the queue is empty
+	bool try_pop(T& out)
+	{
+		while(true)
+		{
+			Node* head = HazardPointers::protect(0, head_);
+			Node* tail = tail_.load(std::memory_order_acquire);
+			Node* next = HazardPointers::protect(1, head->next);
+			if(head != head_.load(std::memory_order_acquire)) continue;
+
+			if(next == nullptr)
+			{
+				HazardPointers::clear(0);
+				HazardPointers::clear(1);
+				return false;
+			}
+
+			if(head == tail)
+			{
+				tail_.compare_exchange_weak(tail, next, std::memory_order_release, std::memory_order_relaxed);
+				continue;
+			}
+
+			if(head_.compare_exchange_strong(head, next, std::memory_order_acq_rel, std::memory_order_relaxed))
+			{
+				// next is the new dummy, only the thread that moved the head past it may touch its element
+				out = std::move(next->data);
+				next->data.~T();
+				HazardPointers::clear(0);
+				HazardPointers::clear(1);
+				HazardPointers::retire(head, &recycle_node);
+				return true;
+			}
+		}
+	}
+
+	// Only a snapshot, other threads may change the queue right after
+	[[nodiscard]] bool empty() const
+	{
+		const Node* head = HazardPointers::protect(0, head_);
+		const bool res = head->next.load(std::memory_order_acquire) == nullptr;
+		HazardPointers::clear(0);
+		return res;
+	}
+
+private:
+	alignas(CACHE_LINE_SIZE) std::atomic<Node*> head_;
+	alignas(CACHE_LINE_SIZE) std::atomic<Node*> tail_;
+
+	static NodePool& pool()
+	{
+		thread_local NodePool pool;
+		return pool;
+	}
+
+	static Node* allocate_node()
+	{
+		NodePool& free = pool();
+		if(free.head == nullptr) return new Node();
+
+		Node* node = free.head;
+		free.head = node->next.load(std::memory_order_relaxed);
+		free.size--;
+		node->next.store(nullptr, std::memory_order_relaxed);
+		return node;
+	}
+
+	// Called by HazardPointers once no thread protects the node anymore, its element was already moved out
+	static void recycle_node(void* ptr)
+	{
+		Node* node = static_cast<Node*>(ptr);
+		if(NodePool::destroyed())
+		{
+			delete node;
+			return;
+		}
+
+		NodePool& free = pool();
+		if(free.size >= QUEUE_NODE_POOL_SIZE)
+		{
+			delete node;
+			return;
+		}
+		node->next.store(free.head, std::memory_order_relaxed);
+		free.head = node;
+		free.size++;
+	}
+};
+
+#endif // CONCURRENT_QUEUE_H
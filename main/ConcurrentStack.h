@@ -0,0 +1,192 @@
+#ifndef CONCURRENT_STACK_H
+#define CONCURRENT_STACK_H
+
+#include <atomic>
+#include <thread>
+#include <type_traits>
+#include <functional>
+#include "CacheLine.h"
+#include "HazardPointers.h"
+
+enum
+{
+	STACK_ELIMINATION_SLOTS = 8,
+	// How often a push waits for a pop to take its offered node before it retries the stack itself
+	STACK_ELIMINATION_SPINS = 128
+};
+
+// Lock-free Treiber stack, any amount of threads may push and pop at the same time.
+// Popped nodes are reclaimed through HazardPointers, which also protects the head CAS against ABA.
+// With UseElimination a push and a pop that collide on the head can hand the element over through a side array instead,
+// which keeps the stack scaling under heavy contention.
+template <typename T, bool UseElimination = false>
+class ConcurrentStack
+{
+	static_assert(!std::is_pointer_v<T>, "Attempted to make a ConcurrentStack with a raw pointer type");
+
+	struct Node
+	{
+		T data;
+		Node* next;
+
+		template <typename... Args>
+		explicit Node(Args&&... args) : data(std::forward<Args>(args)...), next(nullptr) {}
+	};
+
+	struct alignas(CACHE_LINE_SIZE) EliminationSlot
+	{
+		std::atomic<Node*> offer;
+	};
+
+public:
+	ConcurrentStack() : head_(nullptr), elimination_{} {}
+
+	~ConcurrentStack()
+	{
+		Node* current = head_.load(std::memory_order_relaxed);
+		while(current != nullptr)
+		{
+			Node* next = current->next;
+			delete current;
+			current = next;
+		}
+	}
+
+	// Other threads could hold on to nodes of this stack, so it can not be copied or moved
+	ConcurrentStack(const ConcurrentStack& other) = delete;
+	ConcurrentStack& operator=(const ConcurrentStack& other) = delete;
+	ConcurrentStack(ConcurrentStack&& other) = delete;
+	ConcurrentStack& operator=(ConcurrentStack&& other) = delete;
+
+	void push(const T& data)
+	{
+		push_node(new Node(data));
+	}
+
+	void push(T&& data)
+	{
+		push_node(new Node(std::move(data)));
+	}
+
+	template <typename... Args>
+	void emplace(Args&&... args)
+	{
+		push_node(new Node(std::forward<Args>(args)...));
+	}
+
+	// Moves the top element into out, returns false without blocking when the stack is empty
+	bool try_pop(T& out)
+	{
+		while(true)
+		{
+			Node* top = HazardPointers::protect(0, head_);
+			if(top == nullptr)
+			{
+				HazardPointers::clear(0);
+				return false;
+			}
+
+			// top can not be freed while it is protected, so its next pointer is still the one it was pushed with
+			if(head_.compare_exchange_weak(top, top->next, std::memory_order_acquire, std::memory_order_relaxed))
+			{
+				HazardPointers::clear(0);
+				out = std::move(top->data);
+				HazardPointers::retire(top);
+				return true;
+			}
+
+			if constexpr(UseElimination)
+			{
+				HazardPointers::clear(0);
+				if(try_take_offer(out)) return true;
+			}
+		}
+	}
+
+	// Only a snapshot, other threads may change the stack right after
+	[[nodiscard]] bool empty() const noexcept
+	{
+		return head_.load(std::memory_order_acquire) == nullptr;
+	}
+
+	// Not safe to call while other threads use the stack
+	void clear() noexcept
+	{
+		Node* current = head_.exchange(nullptr, std::memory_order_acquire);
+		while(current != nullptr)
+		{
+			Node* next = current->next;
+			delete current;
+			current = next;
+		}
+	}
+
+private:
+	alignas(CACHE_LINE_SIZE) std::atomic<Node*> head_;
+	EliminationSlot elimination_[STACK_ELIMINATION_SLOTS];
+
+	void push_node(Node* node)
+	{
+		node->next = head_.load(std::memory_order_relaxed);
+		while(!head_.compare_exchange_weak(node->next, node, std::memory_order_release, std::memory_order_relaxed))
+		{
+			if constexpr(UseElimination)
+			{
+				if(try_offer(node)) return;
+				node->next = head_.load(std::memory_order_relaxed);
+			}
+		}
+	}
+
+	static size_t elimination_index() noexcept
+	{
+		thread_local size_t state = std::hash<std::thread::id>{}(std::this_thread::get_id()) | 1;
+		state ^= state << 13;
+		state ^= state >> 7;
+		state ^= state << 17;
+		return state % STACK_ELIMINATION_SLOTS;
+	}
+
+	// Offers node to a concurrent pop, returns true when a pop took it
+	bool try_offer(Node* node)
+	{
+		std::atomic<Node*>& offer = elimination_[elimination_index()].offer;
+		Node* expected = nullptr;
+		// A pop retires the node it takes, protecting it keeps its address from being reused for another offer while waiting
+		HazardPointers::set(1, node);
+		if(!offer.compare_exchange_strong(expected, node, std::memory_order_release, std::memory_order_relaxed))
+		{
+			HazardPointers::clear(1);
+			return false;
+		}
+
+		for(size_t i = 0; i < STACK_ELIMINATION_SPINS; i++)
+		{
+			if(offer.load(std::memory_order_relaxed) != node)
+			{
+				HazardPointers::clear(1);
+				return true;
+			}
+		}
+
+		expected = node;
+		const bool taken = !offer.compare_exchange_strong(expected, nullptr, std::memory_order_relaxed);
+		HazardPointers::clear(1);
+		return taken;
+	}
+
+	// Takes an element offered by a concurrent push
+	bool try_take_offer(T& out)
+	{
+		std::atomic<Node*>& offer = elimination_[elimination_index()].offer;
+		Node* node = offer.load(std::memory_order_relaxed);
+		if(node == nullptr || !offer.compare_exchange_strong(node, nullptr, std::memory_order_acquire, std::memory_order_relaxed))
+			return false;
+
+		out = std::move(node->data);
+		HazardPointers::retire(node);
+		return true;
+	}
+};
+
+#endif // CONCURRENT_STACK_H
@@ -4,13 +4,15 @@
 #include <vector>
 #include <array>
 #include <stdexcept>
+#include <functional>
 #include "TypeTraitsCheck.h"
+#include <memory>
+#include <utility>
 #include <string>
 
 template <typename T>
 class DLinkedList
 {
-	static_assert(std::is_copy_constructible_v<T>, "Attempted to make a DLinkedList with a type that does not implement a copy constructor");
 	static_assert(!std::is_pointer_v<T>, "Attempted to make a DLinkedList with a raw pointer type");
 	template <typename Y>
 	struct Node
@@ -19,13 +21,8 @@ class DLinkedList
 		Node* next;
 		Node* prev;
 
-		explicit Node(Y data) : data(std::make_unique<Y>(data)), next(nullptr), prev(nullptr) {}
-
-		explicit Node(Y** data) : data(std::make_unique<Y>(std::move(data))), next(nullptr), prev(nullptr) {}
-
-		explicit Node(Y data, Node* next, Node* prev) : data(std::make_unique<Y>(data)), next(next), prev(prev) {}
-
-		explicit Node(Y** data, Node* next, Node* prev) : data(std::make_unique<Y>(std::move(data))), next(next), prev(prev) {}
+		template <typename... Args>
+		explicit Node(Args&&... args) : data(std::make_unique<Y>(std::forward<Args>(args)...)), next(nullptr), prev(nullptr) {}
 	};
 public:
 	class Iterator
@@ -76,15 +73,110 @@ public:
 		return Iterator(nullptr);
 	}
 
+	// A position in the list that supports O(1) insertion and removal in both directions.
+	// Any structural change made through the list itself (or another cursor) invalidates the cursor.
+	class Cursor
+	{
+		friend class DLinkedList;
+	public:
+		explicit Cursor(DLinkedList* list, Node<T>* node, const size_t index) : list_(list), node_(node), index_(index) {}
+
+		[[nodiscard]] bool at_end() const noexcept
+		{
+			return node_ == nullptr;
+		}
+
+		[[nodiscard]] size_t index() const noexcept
+		{
+			return index_;
+		}
+
+		T& operator*() const
+		{
+			if(node_ == nullptr) throw std::out_of_range("Cursor out of bounds");
+			return *(node_->data);
+		}
+
+		T* operator->() const
+		{
+			if(node_ == nullptr) throw std::out_of_range("Cursor out of bounds");
+			return node_->data.get();
+		}
+
+		Cursor& operator++()
+		{
+			if(node_ == nullptr) throw std::out_of_range("Cursor out of bounds");
+			node_ = node_->next;
+			index_++;
+			return *this;
+		}
+
+		Cursor& operator--()
+		{
+			if(index_ == 0) throw std::out_of_range("Cursor out of bounds");
+			node_ = node_ == nullptr ? list_->tail_ : node_->prev;
+			index_--;
+			return *this;
+		}
+
+		// Inserts before the current element, the cursor keeps pointing at the same element
+		void insert(const T& data)
+		{
+			insert_node(new Node<T>(data));
+		}
+
+		void insert(T&& data)
+		{
+			insert_node(new Node<T>(std::move(data)));
+		}
+
+		// Removes the current element, the cursor moves on to the next element
+		void erase()
+		{
+			if(node_ == nullptr) throw std::out_of_range("Cursor out of bounds");
+			list_->invalidate_cache_from(index_);
+			Node<T>* next = node_->next;
+			delete list_->unlink(node_);
+			node_ = next;
+		}
+
+	private:
+		DLinkedList* list_;
+		Node<T>* node_;
+		size_t index_;
+
+		void insert_node(Node<T>* newNode)
+		{
+			list_->invalidate_cache_from(index_);
+			list_->link_before(node_, newNode);
+			index_++;
+		}
+	};
+
+	Cursor cursor()
+	{
+		return Cursor(this, head_, 0);
+	}
+
+	// index may be equal to size(), which gives a cursor past the last element
+	Cursor cursor_at(const size_t index)
+	{
+		if(index == count_) return Cursor(this, nullptr, index);
+		if(index < count_) return Cursor(this, unsafe_get_pointer_at(index), index);
+
+		throw std::out_of_range("Index out of bounds\nindex: " + std::to_string(index) + "\nsize: " + std::to_string(count_));
+	}
+
 	DLinkedList() : count_(0), head_(nullptr), tail_(nullptr)  {}
 
 	explicit DLinkedList(T data[], const size_t size) : count_(size)
 	{
 		head_ = new Node<T>(data[0]);
 		Node<T>* current = head_;
-		for(size_t i = 0; i < count_; i++)
+		for(size_t i = 1; i < count_; i++)
 		{
-			current->next = new Node<T>(data[i], nullptr, current);
+			current->next = new Node<T>(data[i]);
+			current->next->prev = current;
 			current = current->next;
 		}
 		tail_ = current;
@@ -92,12 +184,13 @@ public:
 
 	explicit DLinkedList(std::vector<T> data) : count_(data.size())
 	{
-		const T* p = data.data();
-		head_ = new Node<T>(p[0]);
+		T* p = data.data();
+		head_ = new Node<T>(std::move(p[0]));
 		Node<T>* current = head_;
-		for(size_t i = 0; i < count_; i++)
+		for(size_t i = 1; i < count_; i++)
 		{
-			current->next = new Node<T>(std::move(p[i]), nullptr, current);
+			current->next = new Node<T>(std::move(p[i]));
+			current->next->prev = current;
 			current = current->next;
 		}
 		tail_ = current;
@@ -107,11 +200,12 @@ public:
 	explicit DLinkedList(std::array<T, N> data) : count_(data.size())
 	{
 		T* p = data.data();
-		head_ = new Node<T>(p[0]);
+		head_ = new Node<T>(std::move(p[0]));
 		Node<T>* current = head_;
-		for(size_t i = 0; i < count_; i++)
+		for(size_t i = 1; i < count_; i++)
 		{
-			current->next = new Node<T>(std::move(p[i]), nullptr, current);
+			current->next = new Node<T>(std::move(p[i]));
+			current->next->prev = current;
 			current = current->next;
 		}
 		tail_ = current;
@@ -124,7 +218,8 @@ public:
 		Node<T>* current = head_;
 		for(size_t i = 1; i < count_; i++)
 		{
-			current->next = new Node<T>(p[i], nullptr, current);
+			current->next = new Node<T>(p[i]);
+			current->next->prev = current;
 			current = current->next;
 		}
 		tail_ = current;
@@ -141,29 +236,19 @@ public:
 		}
 	}
 
-	DLinkedList(const DLinkedList& other) : count_(other.count_), head_(nullptr), tail_(nullptr)
+	DLinkedList(const DLinkedList& other) requires std::is_copy_constructible_v<T> : count_(0), head_(nullptr), tail_(nullptr)
 	{
-		Node<T>* current = new Node<T>(*(other.head_->data));
-
-		while(current != nullptr)
-		{
+		for(Node<T>* current = other.head_; current != nullptr; current = current->next)
 			append(*(current->data));
-			current = current->next;
-		}
 	}
 
-	DLinkedList& operator=(const DLinkedList& other)
+	DLinkedList& operator=(const DLinkedList& other) requires std::is_copy_constructible_v<T>
 	{
 		if(this == &other) return *this;
 
 		clear();
-
-		Node<T>* current = new Node<T>(*(other.head_->data));
-		while(current != nullptr)
-		{
+		for(Node<T>* current = other.head_; current != nullptr; current = current->next)
 			append(*(current->data));
-			current = current->next;
-		}
 
 		return *this;
 	}
@@ -176,11 +261,12 @@ public:
 		other.count_ = 0;
 		other.head_ = nullptr;
 		other.tail_ = nullptr;
+		other.cache_node_ = nullptr;
 	}
 
 	DLinkedList& operator=(DLinkedList&& other) noexcept
 	{
-		if(this == other) return *this;
+		if(this == &other) return *this;
 
 		clear();
 
@@ -190,10 +276,26 @@ public:
 		other.count_ = 0;
 		other.head_ = nullptr;
 		other.tail_ = nullptr;
+		other.cache_node_ = nullptr;
 
 		return *this;
 	}
 
+	// Only exchanges the head and tail pointers, no node is touched
+	void swap(DLinkedList& other) noexcept
+	{
+		std::swap(head_, other.head_);
+		std::swap(tail_, other.tail_);
+		std::swap(count_, other.count_);
+		std::swap(cache_node_, other.cache_node_);
+		std::swap(cache_index_, other.cache_index_);
+	}
+
+	friend void swap(DLinkedList& a, DLinkedList& b) noexcept
+	{
+		a.swap(b);
+	}
+
 	template <typename U = T, std::enable_if_t<is_printable<U>::value, int> = 0>
 	friend std::ostream& operator<<(std::ostream& os, const DLinkedList& list)
 	{
@@ -263,7 +365,7 @@ public:
 		count_++;
 	}
 
-	void append(const T&& data) noexcept
+	void append(T&& data) noexcept
 	{
 		Node<T>* newNode = new Node<T>(std::move(data));
 		if(head_ == nullptr)
@@ -282,12 +384,14 @@ public:
 
 	void prepend(const T& data) noexcept
 	{
-		Node<T>* newNode = new Node<T>(data, nullptr, head_);
+		invalidate_cache_from(0);
+		Node<T>* newNode = new Node<T>(data);
 		if(head_ == nullptr)
 		{
 			head_ = newNode;
 			tail_ = newNode;
 		}
+		else
 		{
 			head_->prev = newNode;
 			newNode->next = head_;
@@ -298,12 +402,14 @@ public:
 
 	void prepend(T&& data) noexcept
 	{
-		Node<T>* newNode = new Node<T>(std::move(data), nullptr, head_);
+		invalidate_cache_from(0);
+		Node<T>* newNode = new Node<T>(std::move(data));
 		if(head_ == nullptr)
 		{
 			head_ = newNode;
 			tail_ = newNode;
 		}
+		else
 		{
 			head_->prev = newNode;
 			newNode->next = head_;
@@ -312,7 +418,30 @@ public:
 		count_++;
 	}
 
-	[[nodiscard]] T front() const
+	template <typename... Args>
+	T& emplace_back(Args&&... args)
+	{
+		Node<T>* newNode = new Node<T>(std::forward<Args>(args)...);
+		link_before(nullptr, newNode);
+		return *(newNode->data);
+	}
+
+	template <typename... Args>
+	T& emplace_front(Args&&... args)
+	{
+		invalidate_cache_from(0);
+		Node<T>* newNode = new Node<T>(std::forward<Args>(args)...);
+		link_before(head_, newNode);
+		return *(newNode->data);
+	}
+
+	[[nodiscard]] T& front()
+	{
+		if(head_ != nullptr) return *(head_->data);
+		throw std::out_of_range("List is empty");
+	}
+
+	[[nodiscard]] const T& front() const
 	{
 		if(head_ != nullptr) return *(head_->data);
 		throw std::out_of_range("List is empty");
@@ -322,8 +451,9 @@ public:
 	{
 		if(head_ != nullptr)
 		{
+			invalidate_cache_from(0);
 			const Node<T>* temp = head_;
-			T res = *(head_->data);
+			T res = std::move(*(head_->data));
 			if(head_ == tail_)
 			{
 				head_ = nullptr;
@@ -342,7 +472,67 @@ public:
 		throw std::out_of_range("List is empty");
 	}
 
-	[[nodiscard]] T back() const
+	// Links copies of first..last behind the list in one go
+	template <typename InputIt>
+	size_t append_range(InputIt first, InputIt last)
+	{
+		if(first == last) return 0;
+
+		Node<T>* chainHead = new Node<T>(*first);
+		Node<T>* chainTail = chainHead;
+		size_t count = 1;
+		try
+		{
+			for(++first; first != last; ++first, count++)
+			{
+				Node<T>* node = new Node<T>(*first);
+				node->prev = chainTail;
+				chainTail->next = node;
+				chainTail = node;
+			}
+		}
+		catch(...)
+		{
+			delete_chain(chainHead);
+			throw;
+		}
+
+		link_range_before(nullptr, chainHead, chainTail, count);
+		return count;
+	}
+
+	// Moves up to n elements from the front into out and unlinks them all at once, returns how many were moved
+	template <typename OutputIt>
+	size_t pop_front_n(OutputIt out, const size_t n)
+	{
+		const size_t count = n < count_ ? n : count_;
+		if(count == 0) return 0;
+
+		invalidate_cache_from(0);
+		Node<T>* current = head_;
+		for(size_t i = 0; i < count; i++, ++out)
+		{
+			*out = std::move(*(current->data));
+			Node<T>* next = current->next;
+			delete current;
+			current = next;
+		}
+		head_ = current;
+		if(head_ == nullptr)
+			tail_ = nullptr;
+		else
+			head_->prev = nullptr;
+		count_ -= count;
+		return count;
+	}
+
+	[[nodiscard]] T& back()
+	{
+		if(tail_ != nullptr) return *(tail_->data);
+		throw std::out_of_range("List is empty");
+	}
+
+	[[nodiscard]] const T& back() const
 	{
 		if(tail_ != nullptr) return *(tail_->data);
 		throw std::out_of_range("List is empty");
@@ -352,8 +542,9 @@ public:
 	{
 		if(tail_ != nullptr)
 		{
+			invalidate_cache_from(count_ - 1);
 			const Node<T>* temp = tail_;
-			T res = *(tail_->data);
+			T res = std::move(*(tail_->data));
 			if(head_ == tail_)
 			{
 				head_ = nullptr;
@@ -376,10 +567,12 @@ public:
 	{
 		if(index < count_)
 		{
+			invalidate_cache_from(index);
 			Node<T>* newNode = new Node<T>(data);
 			if(index == 0)
 			{
 				newNode->next = head_;
+				head_->prev = newNode;
 				head_ = newNode;
 			}
 			else
@@ -401,10 +594,12 @@ public:
 	{
 		if(index < count_)
 		{
+			invalidate_cache_from(index);
 			Node<T>* newNode = new Node<T>(std::move(data));
 			if(index == 0)
 			{
 				newNode->next = head_;
+				head_->prev = newNode;
 				head_ = newNode;
 			}
 			else
@@ -425,6 +620,7 @@ public:
 	{
 		if(index < count_)
 		{
+			invalidate_cache_from(index);
 			if(index == 0)
 			{
 				if(head_ == tail_)
@@ -454,6 +650,7 @@ public:
 				remove->prev->next = remove->next;
 				remove->next->prev = remove->prev;
 				delete remove;
+				invalidate_cache_from(index);
 			}
 			count_--;
 		}
@@ -461,18 +658,176 @@ public:
 			throw std::out_of_range("Index out of bounds\nindex: " + std::to_string(index) + "\nsize: " + std::to_string(count_));
 	}
 
-	void clear() noexcept
+	// Moves every element of other in front of pos without copying, other is left empty
+	void splice(const Cursor& pos, DLinkedList& other)
+	{
+		if(pos.list_ != this) throw std::invalid_argument("Cursor does not belong to this list");
+		if(&other == this || other.head_ == nullptr) return;
+
+		invalidate_cache_from(pos.index_);
+		link_range_before(pos.node_, other.head_, other.tail_, other.count_);
+		other.head_ = nullptr;
+		other.tail_ = nullptr;
+		other.count_ = 0;
+		other.cache_node_ = nullptr;
+	}
+
+	// Moves the elements of other in [first, last) in front of pos without copying
+	void splice(const Cursor& pos, DLinkedList& other, const Cursor& first, const Cursor& last)
+	{
+		if(pos.list_ != this) throw std::invalid_argument("Cursor does not belong to this list");
+		if(first.list_ != &other || last.list_ != &other) throw std::invalid_argument("Range does not belong to the other list");
+		if(first.index_ > last.index_) throw std::invalid_argument("Range start lies after range end");
+		const size_t moved = last.index_ - first.index_;
+		if(moved == 0) return;
+		if(&other == this)
+		{
+			if(pos.index_ == first.index_ || pos.index_ == last.index_) return;
+			if(pos.index_ > first.index_ && pos.index_ < last.index_) throw std::invalid_argument("Cannot splice a range into itself");
+		}
+
+		other.invalidate_cache_from(first.index_);
+		invalidate_cache_from(pos.index_);
+		Node<T>* firstNode = first.node_;
+		Node<T>* lastNode = last.node_ == nullptr ? other.tail_ : last.node_->prev;
+		other.unlink_range(firstNode, lastNode, moved);
+		link_range_before(pos.node_, firstNode, lastNode, moved);
+	}
+
+	// Keeps the elements before index and returns the rest as a new list without copying
+	DLinkedList split_at(const size_t index)
+	{
+		if(index > count_)
+			throw std::out_of_range("Index out of bounds\nindex: " + std::to_string(index) + "\nsize: " + std::to_string(count_));
+
+		DLinkedList res;
+		if(index == count_) return res;
+
+		Node<T>* first = unsafe_get_pointer_at(index);
+		invalidate_cache_from(index);
+		res.head_ = first;
+		res.tail_ = tail_;
+		res.count_ = count_ - index;
+		tail_ = first->prev;
+		if(tail_ == nullptr)
+			head_ = nullptr;
+		else
+			tail_->next = nullptr;
+		first->prev = nullptr;
+		count_ = index;
+		return res;
+	}
+
+	// Appends every element of other without copying
+	void concat(DLinkedList&& other)
+	{
+		if(&other == this || other.head_ == nullptr) return;
+
+		link_range_before(nullptr, other.head_, other.tail_, other.count_);
+		other.head_ = nullptr;
+		other.tail_ = nullptr;
+		other.count_ = 0;
+		other.cache_node_ = nullptr;
+	}
+
+	// Stable bottom-up merge sort, relinks the nodes instead of moving elements and needs no extra memory
+	template <typename Compare = std::less<T>>
+	void sort(Compare comp = Compare())
+	{
+		if(count_ < 2) return;
+
+		cache_node_ = nullptr;
+		for(size_t width = 1; width < count_; width *= 2)
+		{
+			Node<T>* rest = head_;
+			Node<T>* sortedTail = nullptr;
+			while(rest != nullptr)
+			{
+				Node<T>* left = rest;
+				Node<T>* right = cut_chain(left, width);
+				rest = cut_chain(right, width);
+
+				Node<T>* mergedTail;
+				Node<T>* merged = merge_chains(left, right, comp, mergedTail);
+				if(sortedTail == nullptr)
+					head_ = merged;
+				else
+					sortedTail->next = merged;
+				sortedTail = mergedTail;
+			}
+			tail_ = sortedTail;
+		}
+		relink_prev();
+	}
+
+	// Merges the sorted other into this sorted list without copying, other is left empty
+	template <typename Compare = std::less<T>>
+	void merge(DLinkedList& other, Compare comp = Compare())
+	{
+		if(&other == this || other.head_ == nullptr) return;
+
+		cache_node_ = nullptr;
+		head_ = merge_chains(head_, other.head_, comp, tail_);
+		count_ += other.count_;
+		other.head_ = nullptr;
+		other.tail_ = nullptr;
+		other.count_ = 0;
+		other.cache_node_ = nullptr;
+		relink_prev();
+	}
+
+	// Removes consecutive equal elements, returns the amount of elements removed
+	template <typename U = T, std::enable_if_t<is_equatable<U>::value, int> = 0>
+	size_t unique() noexcept
+	{
+		if(count_ < 2) return 0;
+
+		cache_node_ = nullptr;
+		size_t removed = 0;
+		Node<T>* current = head_;
+		while(current->next != nullptr)
+		{
+			Node<T>* next = current->next;
+			if(*(next->data) == *(current->data))
+			{
+				current->next = next->next;
+				if(next->next != nullptr)
+					next->next->prev = current;
+				delete next;
+				removed++;
+			}
+			else
+				current = next;
+		}
+		tail_ = current;
+		count_ -= removed;
+		return removed;
+	}
+
+	void reverse() noexcept
 	{
+		cache_node_ = nullptr;
 		Node<T>* current = head_;
+		Node<T>* prev = nullptr;
+		tail_ = head_;
 		while(current != nullptr)
 		{
 			Node<T>* next = current->next;
-			delete current;
+			current->next = prev;
+			current->prev = next;
+			prev = current;
 			current = next;
 		}
+		head_ = prev;
+	}
+
+	void clear() noexcept
+	{
+		delete_chain(head_);
 		head_ = nullptr;
 		tail_ = nullptr;
 		count_ = 0;
+		cache_node_ = nullptr;
 	}
 
 	[[nodiscard]] size_t size() const noexcept
@@ -489,6 +844,10 @@ private:
 	size_t count_;
 	Node<T>* head_;
 	Node<T>* tail_;
+	// Last node looked up by index, lets neighbouring index access start from there instead of head_ or tail_
+	// Because of this, even const lookups modify the list and are not safe to call concurrently
+	mutable Node<T>* cache_node_ = nullptr;
+	mutable size_t cache_index_ = 0;
 
 	Node<T>* unsafe_get_pointer_at(const size_t index) const
 	{
@@ -498,25 +857,160 @@ private:
 		{
 			pos = 0;
 			res = head_;
-			while(pos != index)
-			{
-				res = res->next;
-				pos++;
-			}
 		}
 		else
 		{
 			pos = count_ - 1;
 			res = tail_;
-			while(pos != index)
+		}
+
+		if(cache_node_ != nullptr)
+		{
+			const size_t fromCache = cache_index_ < index ? index - cache_index_ : cache_index_ - index;
+			const size_t fromEnd = pos < index ? index - pos : pos - index;
+			if(fromCache < fromEnd)
 			{
-				res = res->prev;
-				pos--;
+				pos = cache_index_;
+				res = cache_node_;
 			}
 		}
 
+		while(pos < index)
+		{
+			res = res->next;
+			pos++;
+		}
+		while(pos > index)
+		{
+			res = res->prev;
+			pos--;
+		}
+
+		cache_node_ = res;
+		cache_index_ = index;
 		return res;
 	}
+
+	// Drops the cached node when its index is affected by a change at index
+	void invalidate_cache_from(const size_t index) noexcept
+	{
+		if(cache_index_ >= index)
+			cache_node_ = nullptr;
+	}
+
+	// Deletes node and every node after it
+	static void delete_chain(Node<T>* node) noexcept
+	{
+		while(node != nullptr)
+		{
+			Node<T>* next = node->next;
+			delete node;
+			node = next;
+		}
+	}
+
+	// Links node before pos, or at the back when pos is nullptr
+	void link_before(Node<T>* pos, Node<T>* node) noexcept
+	{
+		link_range_before(pos, node, node, 1);
+	}
+
+	Node<T>* unlink(Node<T>* node) noexcept
+	{
+		unlink_range(node, node, 1);
+		return node;
+	}
+
+	// Links the chain first..last of length count before pos, or at the back when pos is nullptr
+	void link_range_before(Node<T>* pos, Node<T>* first, Node<T>* last, const size_t count) noexcept
+	{
+		Node<T>* prev = pos == nullptr ? tail_ : pos->prev;
+		first->prev = prev;
+		last->next = pos;
+		if(prev == nullptr)
+			head_ = first;
+		else
+			prev->next = first;
+		if(pos == nullptr)
+			tail_ = last;
+		else
+			pos->prev = last;
+		count_ += count;
+	}
+
+	// Unlinks the chain first..last of length count
+	void unlink_range(Node<T>* first, Node<T>* last, const size_t count) noexcept
+	{
+		if(first->prev == nullptr)
+			head_ = last->next;
+		else
+			first->prev->next = last->next;
+		if(last->next == nullptr)
+			tail_ = first->prev;
+		else
+			last->next->prev = first->prev;
+		first->prev = nullptr;
+		last->next = nullptr;
+		count_ -= count;
+	}
+
+	// Cuts the chain starting at node after n nodes, returns the remainder
+	static Node<T>* cut_chain(Node<T>* node, size_t n) noexcept
+	{
+		while(node != nullptr && n > 1)
+		{
+			node = node->next;
+			n--;
+		}
+		if(node == nullptr) return nullptr;
+
+		Node<T>* rest = node->next;
+		node->next = nullptr;
+		return rest;
+	}
+
+	// Merges two sorted chains through their next pointers, takes from a on ties to stay stable
+	template <typename Compare>
+	static Node<T>* merge_chains(Node<T>* a, Node<T>* b, Compare& comp, Node<T>*& tail)
+	{
+		Node<T>* head = nullptr;
+		Node<T>** link = &head;
+		tail = nullptr;
+		while(a != nullptr && b != nullptr)
+		{
+			if(comp(*(b->data), *(a->data)))
+			{
+				tail = b;
+				b = b->next;
+			}
+			else
+			{
+				tail = a;
+				a = a->next;
+			}
+			*link = tail;
+			link = &(tail->next);
+		}
+
+		*link = a != nullptr ? a : b;
+		while(*link != nullptr)
+		{
+			tail = *link;
+			link = &(tail->next);
+		}
+		return head;
+	}
+
+	// Restores the prev pointers after the chain was relinked through next only
+	void relink_prev() noexcept
+	{
+		Node<T>* prev = nullptr;
+		for(Node<T>* current = head_; current != nullptr; current = current->next)
+		{
+			current->prev = prev;
+			prev = current;
+		}
+	}
 };
 
 #endif // DOUBLY_LINKED_LIST_H
\ No newline at end of file
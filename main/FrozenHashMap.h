@@ -0,0 +1,374 @@
+#ifndef FROZEN_HASH_MAP_H
+#define FROZEN_HASH_MAP_H
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include "HashMap.h"
+#include "Hashing.h"
+#include "TypeTraitsCheck.h"
+
+enum
+{
+	// Average number of keys sharing a pilot, more makes the map smaller and the build slower
+	FROZEN_HASH_MAP_KEYS_PER_BUCKET = 4
+};
+
+// Immutable map on a minimal perfect hash in the style of PTHash, for tables that are built once and then only read.
+// Keys are split into buckets by their hash, and every bucket gets a pilot: a small number that, mixed into the hashes of its keys,
+// sends all of them to slots no other key uses. Buckets are placed largest first while there is still room to find a pilot,
+// and buckets with a single key take whatever slot is left over directly.
+// The entries fill exactly size() slots, and a lookup reads one pilot and compares one key, hit or miss.
+// Lookups with keys that were never inserted land on some slot too, the key comparison rejects them.
+template <typename T, typename U, typename Hash = DefaultHash<T>>
+class FrozenHashMap
+{
+	static_assert(std::is_copy_constructible_v<T>, "Attempted to make a FrozenHashMap with a type that does not implement a copy constructor");
+	static_assert(std::is_copy_constructible_v<U>, "Attempted to make a FrozenHashMap with a value type that does not implement a copy constructor");
+	static_assert(!std::is_pointer_v<T>, "Attempted to make a FrozenHashMap with a raw pointer type");
+	static_assert(is_equatable<T>::value, "Attempted to make a FrozenHashMap with a key type that does not have the '==' operator implemented");
+	static_assert(is_hash_for<Hash, T>::value, "The hash of this FrozenHashMap can not hash its key type, std::hash<T> may not be specialized for it");
+
+	struct Entry
+	{
+		T key;
+		U value;
+	};
+
+	struct Source
+	{
+		const T* key;
+		const U* value;
+	};
+
+	using KeyEqual = std::equal_to<>;
+
+	// A pilot with this bit set holds the slot of a bucket with a single key directly
+	static constexpr uint32_t DIRECT_SLOT = 0x80000000u;
+
+	template <typename K>
+	static constexpr bool is_lookup_key = is_transparent_key<K, T, Hash, KeyEqual>;
+
+public:
+	explicit FrozenHashMap(Hash hash = Hash()) : entries_(nullptr), pilots_(nullptr), size_(0), buckets_(0), hash_(std::move(hash)) {}
+
+	// Freezes a snapshot of map, which has to use the same hash
+	template <typename Layout>
+	explicit FrozenHashMap(const HashMap<T, U, Layout, Hash>& map, Hash hash = Hash()) : FrozenHashMap(std::move(hash))
+	{
+		std::vector<Source> sources;
+		sources.reserve(map.size());
+		map.for_each([&](const T& key, const U& value)
+		{
+			sources.push_back(Source{ &key, &value });
+		});
+		build(sources);
+	}
+
+	// Takes key value pairs, when a key shows up more than once the last value wins
+	template <typename InputIt>
+	FrozenHashMap(InputIt first, InputIt last, Hash hash = Hash()) : FrozenHashMap(hash)
+	{
+		HashMap<T, U, SwissLayout, Hash> map;
+		for(; first != last; ++first)
+			map.insert(first->first, first->second);
+		FrozenHashMap frozen(map, std::move(hash));
+		swap(frozen);
+	}
+
+	~FrozenHashMap()
+	{
+		destroy();
+	}
+
+	FrozenHashMap(const FrozenHashMap& other) : FrozenHashMap(other.hash_)
+	{
+		if(other.size_ == 0) return;
+
+		pilots_ = new uint32_t[other.buckets_];
+		buckets_ = other.buckets_;
+		std::copy(other.pilots_, other.pilots_ + buckets_, pilots_);
+		entries_ = std::allocator<Entry>().allocate(other.size_);
+		size_t constructed = 0;
+		try
+		{
+			for(; constructed < other.size_; constructed++)
+				std::construct_at(&entries_[constructed], other.entries_[constructed]);
+		}
+		catch(...)
+		{
+			std::destroy(entries_, entries_ + constructed);
+			std::allocator<Entry>().deallocate(entries_, other.size_);
+			delete[] pilots_;
+			throw;
+		}
+		size_ = other.size_;
+	}
+
+	FrozenHashMap& operator=(const FrozenHashMap& other)
+	{
+		if(this == &other) return *this;
+
+		FrozenHashMap copy(other);
+		swap(copy);
+		return *this;
+	}
+
+	FrozenHashMap(FrozenHashMap&& other) noexcept : FrozenHashMap(other.hash_)
+	{
+		swap(other);
+	}
+
+	FrozenHashMap& operator=(FrozenHashMap&& other) noexcept
+	{
+		if(this == &other) return *this;
+
+		FrozenHashMap moved(std::move(other));
+		swap(moved);
+		return *this;
+	}
+
+	void swap(FrozenHashMap& other) noexcept
+	{
+		std::swap(entries_, other.entries_);
+		std::swap(pilots_, other.pilots_);
+		std::swap(size_, other.size_);
+		std::swap(buckets_, other.buckets_);
+		std::swap(hash_, other.hash_);
+	}
+
+	friend void swap(FrozenHashMap& a, FrozenHashMap& b) noexcept
+	{
+		a.swap(b);
+	}
+
+	// Returns nullptr when key is not in the map, K is T or anything the hash and equality take transparently
+	template <typename K> requires(std::is_same_v<K, T> || is_lookup_key<K>)
+	[[nodiscard]] const U* find(const K& key) const
+	{
+		if(size_ == 0) return nullptr;
+
+		const Entry& entry = entries_[slot_of(table_hash(hash_, key))];
+		return equal_(entry.key, key) ? &entry.value : nullptr;
+	}
+
+	[[nodiscard]] const U* find(const T& key) const
+	{
+		return find<T>(key);
+	}
+
+	template <typename K> requires(std::is_same_v<K, T> || is_lookup_key<K>)
+	[[nodiscard]] const U& at(const K& key) const
+	{
+		if(const U* value = find(key)) return *value;
+		throw std::out_of_range("Key is not in the FrozenHashMap");
+	}
+
+	[[nodiscard]] const U& at(const T& key) const
+	{
+		return at<T>(key);
+	}
+
+	template <typename K> requires(std::is_same_v<K, T> || is_lookup_key<K>)
+	[[nodiscard]] bool contains_key(const K& key) const
+	{
+		return find(key) != nullptr;
+	}
+
+	[[nodiscard]] bool contains_key(const T& key) const
+	{
+		return find<T>(key) != nullptr;
+	}
+
+	// Calls function with every key and value, in slot order
+	template <typename Function>
+	void for_each(Function function) const
+	{
+		for(size_t i = 0; i < size_; i++)
+			function(static_cast<const T&>(entries_[i].key), static_cast<const U&>(entries_[i].value));
+	}
+
+	[[nodiscard]] size_t size() const noexcept
+	{
+		return size_;
+	}
+
+	[[nodiscard]] bool empty() const noexcept
+	{
+		return size_ == 0;
+	}
+
+private:
+	Entry* entries_;
+	uint32_t* pilots_;
+	size_t size_;
+	size_t buckets_;
+	Hash hash_;
+	KeyEqual equal_;
+
+	// Maps a 64 bit value onto 0..range - 1 with a multiply instead of a division
+	static size_t reduce(uint64_t value, uint64_t range) noexcept
+	{
+		multiply_128(value, range);
+		return static_cast<size_t>(range);
+	}
+
+	// The bucket comes from a mixed hash, because hashes of structured keys like a sequence of ids can be spread so evenly
+	// that every bucket gets about the same number of keys, and the last ones to be placed then find almost no room.
+	// As in PTHash, 60% of the keys go to the first 30% of the buckets, which makes the big buckets that are placed first
+	// bigger and leaves many small ones that are easy to fit into the last free slots
+	[[nodiscard]] size_t bucket_of(const size_t hash) const noexcept
+	{
+		const uint64_t mixed = multiply_fold(hash ^ HASH_SECRET[3], HASH_SECRET[0]);
+		const size_t dense = buckets_ * 3 / 10;
+		if(static_cast<uint32_t>(mixed) < 0x99999999u) return reduce(mixed, dense);
+		return dense + reduce(mixed, buckets_ - dense);
+	}
+
+	static uint64_t multiplier_of(const uint32_t pilot) noexcept
+	{
+		return multiply_fold(pilot ^ HASH_SECRET[0], HASH_SECRET[1]) | 1;
+	}
+
+	// Slot a key goes to under the pilot the multiplier was made from
+	[[nodiscard]] size_t position(const size_t hash, const uint64_t multiplier) const noexcept
+	{
+		return reduce(multiply_fold(hash ^ HASH_SECRET[2], multiplier), size_);
+	}
+
+	[[nodiscard]] size_t slot_of(const size_t hash) const noexcept
+	{
+		const uint32_t pilot = pilots_[bucket_of(hash)];
+		return (pilot & DIRECT_SLOT) != 0 ? pilot & ~DIRECT_SLOT : position(hash, multiplier_of(pilot));
+	}
+
+	// A constructor that throws from its body still runs the destructor, so a failed build has to leave the map empty
+	void build(const std::vector<Source>& sources)
+	{
+		try
+		{
+			place(sources);
+		}
+		catch(...)
+		{
+			size_ = 0;
+			buckets_ = 0;
+			throw;
+		}
+	}
+
+	void place(const std::vector<Source>& sources)
+	{
+		const size_t count = sources.size();
+		if(count == 0) return;
+		if(count >= DIRECT_SLOT) throw std::length_error("A FrozenHashMap holds less than 2^31 entries");
+
+		size_ = count;
+		buckets_ = count / FROZEN_HASH_MAP_KEYS_PER_BUCKET + 1;
+
+		// Sort the keys by bucket
+		std::vector<size_t> hashes(count);
+		std::vector<size_t> bucketStart(buckets_ + 1, 0);
+		for(size_t i = 0; i < count; i++)
+		{
+			hashes[i] = table_hash(hash_, *sources[i].key);
+			bucketStart[bucket_of(hashes[i]) + 1]++;
+		}
+		for(size_t b = 0; b < buckets_; b++)
+			bucketStart[b + 1] += bucketStart[b];
+		std::vector<size_t> keys(count);
+		std::vector<size_t> cursor(bucketStart.begin(), bucketStart.end() - 1);
+		for(size_t i = 0; i < count; i++)
+			keys[cursor[bucket_of(hashes[i])]++] = i;
+
+		std::vector<size_t> order(buckets_);
+		for(size_t b = 0; b < buckets_; b++)
+			order[b] = b;
+		std::sort(order.begin(), order.end(), [&](const size_t a, const size_t b)
+		{
+			return bucketStart[a + 1] - bucketStart[a] > bucketStart[b + 1] - bucketStart[b];
+		});
+
+		std::unique_ptr<uint32_t[]> pilots(new uint32_t[buckets_]());
+		std::vector<bool> taken(count, false);
+		std::vector<size_t> slots(count);
+		std::vector<size_t> positions;
+		size_t nextFree = 0;
+		for(const size_t bucket : order)
+		{
+			const size_t* first = keys.data() + bucketStart[bucket];
+			const size_t length = bucketStart[bucket + 1] - bucketStart[bucket];
+			if(length == 0) break;
+
+			if(length == 1)
+			{
+				while(taken[nextFree])
+					nextFree++;
+				taken[nextFree] = true;
+				slots[first[0]] = nextFree;
+				pilots[bucket] = DIRECT_SLOT | static_cast<uint32_t>(nextFree);
+				continue;
+			}
+
+			// Keys with the same hash get the same slot under every pilot
+			for(size_t i = 0; i < length; i++)
+				for(size_t j = i + 1; j < length; j++)
+					if(hashes[first[i]] == hashes[first[j]])
+						throw std::invalid_argument("FrozenHashMap can not separate keys with the same hash");
+
+			for(uint32_t pilot = 0;; pilot++)
+			{
+				if(pilot == DIRECT_SLOT) throw std::runtime_error("FrozenHashMap found no pilot for a bucket");
+
+				const uint64_t multiplier = multiplier_of(pilot);
+				positions.clear();
+				for(size_t i = 0; i < length; i++)
+				{
+					const size_t slot = position(hashes[first[i]], multiplier);
+					if(taken[slot] || std::find(positions.begin(), positions.end(), slot) != positions.end()) break;
+					positions.push_back(slot);
+				}
+				if(positions.size() < length) continue;
+
+				for(size_t i = 0; i < length; i++)
+				{
+					taken[positions[i]] = true;
+					slots[first[i]] = positions[i];
+				}
+				pilots[bucket] = pilot;
+				break;
+			}
+		}
+
+		Entry* entries = std::allocator<Entry>().allocate(count);
+		size_t constructed = 0;
+		try
+		{
+			for(; constructed < count; constructed++)
+				std::construct_at(&entries[slots[constructed]], Entry{ *sources[constructed].key, *sources[constructed].value });
+		}
+		catch(...)
+		{
+			for(size_t i = 0; i < constructed; i++)
+				std::destroy_at(&entries[slots[i]]);
+			std::allocator<Entry>().deallocate(entries, count);
+			throw;
+		}
+		entries_ = entries;
+		pilots_ = pilots.release();
+	}
+
+	void destroy() noexcept
+	{
+		if(size_ == 0) return;
+		std::destroy(entries_, entries_ + size_);
+		std::allocator<Entry>().deallocate(entries_, size_);
+		delete[] pilots_;
+	}
+};
+
+#endif // FROZEN_HASH_MAP_H
@@ -1,16 +1,24 @@
-#ifndef HASHSET_H
-#define HASHSET_H
+#ifndef HASH_MAP_H
+#define HASH_MAP_H
 
+#include <functional>
+#include <stdexcept>
 #include <string>
+#include <utility>
+#include "SwissTable.h"
+#include "RobinHoodTable.h"
 #include "TypeTraitsCheck.h"
 
 enum
 {
-	MAX_LOAD = 70,
-	NEW_LOAD = 30
+	// Keys hashed and prefetched ahead of resolving them in the batch lookups
+	HASH_MAP_BATCH_SIZE = 16
 };
 
-template<typename T, typename U>
+// Layout picks the table engine: SwissLayout for the fastest lookups,
+// RobinHoodLayout for short misses and no tombstones under heavy removal.
+// Hash is any function object from T to size_t, FastHash from Hashing.h is quicker than the default for strings
+template<typename T, typename U, typename Layout = SwissLayout, typename Hash = DefaultHash<T>>
 class HashMap
 {
 	static_assert(std::is_default_constructible_v<T>, "Attempted to make a HashMap with a type that does not implement a default constructor");
@@ -18,256 +26,272 @@ class HashMap
 	static_assert(!std::is_pointer_v<T>, "Attempted to make a HashMap with a raw pointer type");
 	static_assert(is_equatable<T>::value, "Attempted to make a HashMap with a key type that does not have the '==' operator implemented");
 	static_assert(is_equatable<U>::value, "Attempted to make a HashMap with a value type that does not have the '==' operator implemented");
-	static_assert(has_std_hash<T>::value, "This key type does not have a specialized std::hash<T> implementation");
+	static_assert(is_hash_for<Hash, T>::value, "The hash of this HashMap can not hash its key type, std::hash<T> may not be specialized for it");
 
 	struct Entry
 	{
-		size_t hash;
-		U value;
 		T key;
-		Entry* next;
+		U value;
+
+		template <typename K, typename... Args> requires(!std::is_same_v<std::remove_cvref_t<K>, Entry>)
+		explicit Entry(K&& key, Args&&... args) : key(std::forward<K>(key)), value(std::forward<Args>(args)...) {}
 	};
-public:
-	HashMap() : capacity_(0), load_factor_(0), ptr_(new Entry*[16]), count_(0)
-	{
-		for(int i = 0; i < 16; i++)
-			ptr_[i] = nullptr;
-	}
 
-	~HashMap()
+	struct KeyOf
 	{
-		for(int i = 0; i < capacity_; i++)
+		static const T& get(const Entry& entry) noexcept
 		{
-			delete ptr_[i];
+			return entry.key;
 		}
-		delete[] ptr_;
-	}
+	};
+
+	using KeyEqual = std::equal_to<>;
+	using Table = typename Layout::template Table<T, Entry, KeyOf, Hash, KeyEqual>;
+
+	// Lookups with other types than T are only allowed when hash and equality both take them,
+	// a K that would convert to T then matches these overloads better, so no temporary key gets built
+	template <typename K>
+	static constexpr bool is_lookup_key = is_transparent_key<K, T, Hash, KeyEqual>;
+
+public:
+	HashMap() = default;
 
-	HashMap(const HashMap& other) : capacity_(other.capacity_), load_factor_(other.load_factor_), count_(other.count_)
+	~HashMap() = default;
+
+	HashMap(const HashMap& other) = default;
+
+	HashMap& operator=(const HashMap& other) = default;
+
+	// Takes over the table of other, which is left empty
+	HashMap(HashMap&& other) noexcept = default;
+
+	HashMap& operator=(HashMap&& other) noexcept = default;
+
+	void swap(HashMap& other) noexcept
 	{
-		ptr_ = new Entry* [capacity_];
-		for(int i = 0; i < capacity_; i++)
-		{
-			if(other.ptr_[i] != nullptr)	
-				ptr_[i] = new Entry(*(other.ptr_[i]));
-			else 
-				ptr_[i] = nullptr;
-		}
+		table_.swap(other.table_);
 	}
 
-	HashMap& operator=(const HashMap& other)
+	friend void swap(HashMap& a, HashMap& b) noexcept
 	{
-		if(this == &other) return *this;
-
-		clear();
-		capacity_ = other.capacity_;
-		load_factor_ = other.load_factor_;
-		count_ = other.count_;
-		ptr_ = new Entry* [capacity_];
-		for(int i = 0; i < capacity_; i++)
-		{
-			if(other.ptr_[i] != nullptr)	
-				ptr_[i] = new Entry(*(other.ptr_[i]));
-			else 
-				ptr_[i] = nullptr;
-		}
-
-		return *this;
+		a.swap(b);
 	}
 
-	HashMap(HashMap&& other) : capacity_(other.capacity_), load_factor_(other.load_factor_), ptr_(other.ptr_), count_(other.count_)
+	// Inserts a default constructed value when key is not in the map yet
+	U& operator[](const T& key)
 	{
-		other.capacity_ = 0;
-		other.load_factor_ = 0;
-		other.count_ = 0;
-		other.ptr_ = nullptr;
+		return table_.try_emplace(key, key).first->value;
 	}
 
-	HashMap& operator=(HashMap&& other)
+	// Overwrites the value when key is already in the map
+	void insert(T key, U value)
 	{
-		if(this == &other) return *this;
+		auto [entry, inserted] = table_.try_emplace(key, std::move(key), std::move(value));
+		if(!inserted)
+			entry->value = std::move(value);
+	}
 
-		clear();
+	// Constructs the value from args only when key is not in the map yet, returns whether it was inserted
+	template <typename... Args>
+	bool try_emplace(const T& key, Args&&... args)
+	{
+		return table_.try_emplace(key, key, std::forward<Args>(args)...).second;
+	}
 
-		capacity_ = other.capacity_;
-		load_factor_ = other.load_factor_;
-		ptr_ = other.ptr_;
-		count_ = other.count_;
+	// Returns nullptr when key is not in the map
+	[[nodiscard]] U* find(const T& key)
+	{
+		Entry* entry = table_.find(key);
+		return entry == nullptr ? nullptr : &entry->value;
+	}
 
-		other.capacity_ = 0;
-		other.load_factor_ = 0;
-		other.ptr_ = nullptr;
-		other.count_ = 0;
+	[[nodiscard]] const U* find(const T& key) const
+	{
+		const Entry* entry = table_.find(key);
+		return entry == nullptr ? nullptr : &entry->value;
 	}
 
-	U& operator[](const T& key)
+	// Looks up anything comparable to the key without constructing one, like a std::string_view in a map keyed by std::string
+	template <typename K> requires is_lookup_key<K>
+	[[nodiscard]] U* find(const K& key)
 	{
-		const size_t hash_value = hash(key);
-		const size_t index = hash_value % capacity_;
-		if(ptr_[index] == nullptr)
-		{
-			ptr_[index] = new Entry{hash_value, U(), key};
-			count_++;
-			rehash();
-			return ptr_[index]->value;
-		}
+		Entry* entry = table_.find(key);
+		return entry == nullptr ? nullptr : &entry->value;
+	}
 
-		Entry* ret = ptr_[index];
-		while(ret->hash != hash_value)
-			ret = ret->next;
+	template <typename K> requires is_lookup_key<K>
+	[[nodiscard]] const U* find(const K& key) const
+	{
+		const Entry* entry = table_.find(key);
+		return entry == nullptr ? nullptr : &entry->value;
+	}
 
-		return ret->value;
+	[[nodiscard]] U& at(const T& key)
+	{
+		if(U* value = find(key)) return *value;
+		throw std::out_of_range("Key is not in the HashMap");
 	}
 
-	void insert(T key, U value)
+	[[nodiscard]] const U& at(const T& key) const
 	{
-		const size_t hash_value = hash(key);
-		const size_t index = hash_value % capacity_;
+		if(const U* value = find(key)) return *value;
+		throw std::out_of_range("Key is not in the HashMap");
+	}
 
-		Entry* entry = ptr_[index];
-		if(entry == nullptr)
-			ptr_[index] = new Entry(hash_value, value, key, nullptr);
-		else
-			entry->next = new Entry(hash_value, value, key, nullptr);
+	template <typename K> requires is_lookup_key<K>
+	[[nodiscard]] U& at(const K& key)
+	{
+		if(U* value = find(key)) return *value;
+		throw std::out_of_range("Key is not in the HashMap");
+	}
 
-		count_++;
-		rehash();
+	template <typename K> requires is_lookup_key<K>
+	[[nodiscard]] const U& at(const K& key) const
+	{
+		if(const U* value = find(key)) return *value;
+		throw std::out_of_range("Key is not in the HashMap");
 	}
 
-	void remove(const T& key)
+	// Looks up count independent keys, out[i] is the value of keys[i] or nullptr. Returns how many were found.
+	// The keys are hashed and their slots prefetched a batch at a time before any is resolved,
+	// so the cache misses of a batch overlap instead of being paid one after the other
+	template <typename K> requires(std::is_same_v<K, T> || is_lookup_key<K>)
+	size_t find_batch(const K* keys, const size_t count, U** out)
 	{
-		const size_t hash_value = hash(key);
-		const size_t index = hash_value % capacity_;
+		size_t found = 0;
+		lookup_batch(keys, count, [&](const size_t i, const Entry* entry)
+		{
+			out[i] = entry == nullptr ? nullptr : &const_cast<Entry*>(entry)->value;
+			found += entry != nullptr;
+		});
+		return found;
+	}
 
-		Entry* entry = ptr_[index];
-		if(entry == nullptr)
-			return;
-		else
+	template <typename K> requires(std::is_same_v<K, T> || is_lookup_key<K>)
+	size_t find_batch(const K* keys, const size_t count, const U** out) const
+	{
+		size_t found = 0;
+		lookup_batch(keys, count, [&](const size_t i, const Entry* entry)
 		{
-			if(entry.key == key)
-			{
-				const Entry* temp = entry;
-				ptr_[index] = entry->next;
-				delete temp;
-				count_--;
-				return;
-			}
-			Entry* prev = entry;
-			entry = entry->next;
+			out[i] = entry == nullptr ? nullptr : &entry->value;
+			found += entry != nullptr;
+		});
+		return found;
+	}
 
-			while(entry->key != key)
-			{
-				prev = entry;
-				entry = entry->next;
-			}
+	// Same as find_batch, out[i] tells whether keys[i] is in the map
+	template <typename K> requires(std::is_same_v<K, T> || is_lookup_key<K>)
+	size_t contains_batch(const K* keys, const size_t count, bool* out) const
+	{
+		size_t found = 0;
+		lookup_batch(keys, count, [&](const size_t i, const Entry* entry)
+		{
+			out[i] = entry != nullptr;
+			found += entry != nullptr;
+		});
+		return found;
+	}
 
-			prev->next = entry->next;
-			count_--;
-			delete entry;
-		}
+	// Returns whether key was in the map
+	bool remove(const T& key)
+	{
+		return table_.erase(key);
+	}
 
-		rehash();
+	template <typename K> requires is_lookup_key<K>
+	bool remove(const K& key)
+	{
+		return table_.erase(key);
 	}
 
-	bool contains_key(const T& key)
+	[[nodiscard]] bool contains_key(const T& key) const
 	{
-		const size_t hash_value = hash(key);
-		const size_t index = hash_value % capacity_;
+		return table_.find(key) != nullptr;
+	}
 
-		Entry* entry = ptr_[index];
+	template <typename K> requires is_lookup_key<K>
+	[[nodiscard]] bool contains_key(const K& key) const
+	{
+		return table_.find(key) != nullptr;
+	}
 
-		while(entry != nullptr)
+	[[nodiscard]] bool contains_value(const U& value) const
+	{
+		bool found = false;
+		table_.for_each([&](const Entry& entry)
 		{
-			if(entry->key == key) return true;
-			entry = entry->next;
-		}
-
-		return false;
+			found = found || entry.value == value;
+		});
+		return found;
 	}
 
-	bool contains_value(U value)
+	// Calls function with every key and value, in no particular order
+	template <typename Function>
+	void for_each(Function function) const
 	{
-		if(load_factor_ <= 0) return false;
-
-		for(int i = 0; i < capacity_; i++)
+		table_.for_each([&](const Entry& entry)
 		{
-			Entry* entry = ptr_[i];
-			while(entry != nullptr)
-			{
-				if(entry->value == value) return true;
-				entry = entry->next;
-			}
-		}
-		
-		return false;
+			function(entry.key, entry.value);
+		});
 	}
 
 	void clear()
 	{
-		for(int i = 0; i < capacity_; i++)
-		{
-			delete ptr_[i];
-		}
-		delete[] ptr_;
-		capacity_ = 0;
-		load_factor_ = 0;
-		count_ = 0;
-		ptr_ = new Entry*[1];
+		table_.clear();
 	}
 
-private:
-	size_t capacity_;
-	float load_factor_;
-	Entry** ptr_;
-	size_t count_;
+	[[nodiscard]] size_t size() const noexcept
+	{
+		return table_.size();
+	}
 
-	size_t hash(const T& key)
+	[[nodiscard]] bool empty() const noexcept
 	{
-		std::hash<T> hash;
-		return hash(key);
+		return table_.size() == 0;
 	}
 
-	void calc_load_fac()
+	// Makes room for count entries so that inserting them never grows the map
+	void reserve(const size_t count)
 	{
-		size_t nodes[capacity_] = { };
-		for(int i = 0; i < capacity_; i++)
-		{
-			size_t count = 0;
-			Entry* start = ptr_[i];
-			while(start->next != nullptr)
-			{
-				start = start->next;
-				count++;
-			}
+		table_.reserve(count);
+	}
 
-			nodes[i] = count;
-		}
+	// Number of slots, always a power of two or 0 before the first insert
+	[[nodiscard]] size_t capacity() const noexcept
+	{
+		return table_.capacity();
+	}
 
-		size_t res = 0;
-		for(int i = 0; i < capacity_; i++)
-		{
-			res = nodes[i] * nodes[i];
-		}
+	[[nodiscard]] double load_factor() const noexcept
+	{
+		return table_.capacity() == 0 ? 0.0 : static_cast<double>(table_.size()) / static_cast<double>(table_.capacity());
+	}
 
-		load_factor_ = (double)res / capacity_;
+	// Walks the whole table, long probes show keys that hash badly
+	[[nodiscard]] ProbeStats probe_stats() const
+	{
+		return table_.probe_stats();
 	}
 
-	void rehash()
+private:
+	Table table_;
+
+	template <typename K, typename Function>
+	void lookup_batch(const K* keys, const size_t count, Function function) const
 	{
-		calc_load_fac();
-		if(load_factor_ >= (float)MAX_LOAD / 100)
+		size_t hashes[HASH_MAP_BATCH_SIZE];
+		for(size_t start = 0; start < count; start += HASH_MAP_BATCH_SIZE)
 		{
-			// new capacity -> calculated taking average amount of entries per index.
-			// even though load factor is calculated taking the average amount of entries every entry has in its index.
-			size_t new_capacity = count_ / ((float)NEW_LOAD / 100) * 100;
-			Entry** temp = new Entry * [capacity_];
-			for(int i = 0; i < capacity_; i++)
-				temp[i] = ptr_[i];
-
-			delete[] ptr_;
+			const size_t batch = count - start < HASH_MAP_BATCH_SIZE ? count - start : static_cast<size_t>(HASH_MAP_BATCH_SIZE);
+			for(size_t i = 0; i < batch; i++)
+			{
+				hashes[i] = table_.hash_of(keys[start + i]);
+				table_.prefetch(hashes[i]);
+			}
+			for(size_t i = 0; i < batch; i++)
+				function(start + i, table_.find_hashed(keys[start + i], hashes[i]));
 		}
-		calc_load_fac();
 	}
 };
 
-#endif // HASHSET_H
\ No newline at end of file
+#endif // HASH_MAP_H
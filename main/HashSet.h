@@ -0,0 +1,228 @@
+#ifndef HASHSET_H
+#define HASHSET_H
+
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <utility>
+#include "SwissTable.h"
+#include "RobinHoodTable.h"
+#include "TypeTraitsCheck.h"
+
+// Set on the same table engines as HashMap, the slots hold the elements themselves so there is no value next to every key.
+// Layout and Hash are picked the same way as for HashMap.
+template <typename T, typename Layout = SwissLayout, typename Hash = DefaultHash<T>>
+class HashSet
+{
+	static_assert(std::is_copy_constructible_v<T>, "Attempted to make a HashSet with a type that does not implement a copy constructor");
+	static_assert(!std::is_pointer_v<T>, "Attempted to make a HashSet with a raw pointer type");
+	static_assert(is_equatable<T>::value, "Attempted to make a HashSet with a type that does not have the '==' operator implemented");
+	static_assert(is_hash_for<Hash, T>::value, "The hash of this HashSet can not hash its element type, std::hash<T> may not be specialized for it");
+
+	struct KeyOf
+	{
+		static const T& get(const T& element) noexcept
+		{
+			return element;
+		}
+	};
+
+	using KeyEqual = std::equal_to<>;
+	using Table = typename Layout::template Table<T, T, KeyOf, Hash, KeyEqual>;
+
+	// Same rule as in HashMap, lookups by other types than T need a transparent hash and equality
+	template <typename K>
+	static constexpr bool is_lookup_key = is_transparent_key<K, T, Hash, KeyEqual>;
+
+public:
+	HashSet() = default;
+
+	HashSet(std::initializer_list<T> init)
+	{
+		insert_range(init.begin(), init.end());
+	}
+
+	~HashSet() = default;
+
+	HashSet(const HashSet& other) = default;
+
+	HashSet& operator=(const HashSet& other) = default;
+
+	HashSet(HashSet&& other) noexcept = default;
+
+	HashSet& operator=(HashSet&& other) noexcept = default;
+
+	void swap(HashSet& other) noexcept
+	{
+		table_.swap(other.table_);
+	}
+
+	friend void swap(HashSet& a, HashSet& b) noexcept
+	{
+		a.swap(b);
+	}
+
+	// Returns whether the element was not in the set yet
+	bool insert(const T& element)
+	{
+		return table_.try_emplace(element, element).second;
+	}
+
+	bool insert(T&& element)
+	{
+		return table_.try_emplace(element, std::move(element)).second;
+	}
+
+	// Reserves room up front when the size of the range is known, returns how many elements were new
+	template <typename InputIt>
+	size_t insert_range(InputIt first, InputIt last)
+	{
+		if constexpr(std::forward_iterator<InputIt>)
+			table_.reserve(size() + static_cast<size_t>(std::distance(first, last)));
+		size_t count = 0;
+		for(; first != last; ++first)
+			count += insert(*first);
+		return count;
+	}
+
+	[[nodiscard]] bool contains(const T& element) const
+	{
+		return table_.find(element) != nullptr;
+	}
+
+	template <typename K> requires is_lookup_key<K>
+	[[nodiscard]] bool contains(const K& element) const
+	{
+		return table_.find(element) != nullptr;
+	}
+
+	// Returns whether the element was in the set
+	bool erase(const T& element)
+	{
+		return table_.erase(element);
+	}
+
+	template <typename K> requires is_lookup_key<K>
+	bool erase(const K& element)
+	{
+		return table_.erase(element);
+	}
+
+	// Adds every element of other. The smaller set is the one walked, when that is this one the result starts as a copy of other
+	void union_with(const HashSet& other)
+	{
+		if(&other == this) return;
+		if(other.size() > size())
+		{
+			HashSet result(other);
+			result.add_all(*this);
+			swap(result);
+		}
+		else
+			add_all(other);
+	}
+
+	// Keeps only the elements that are also in other, by walking the smaller of the two into a fresh set
+	void intersect_with(const HashSet& other)
+	{
+		const HashSet& smaller = other.size() < size() ? other : *this;
+		const HashSet& larger = other.size() < size() ? *this : other;
+		HashSet result;
+		result.reserve(smaller.size());
+		smaller.table_.for_each([&](const T& element)
+		{
+			if(larger.contains(element))
+				result.table_.try_emplace(element, element);
+		});
+		swap(result);
+	}
+
+	// Removes every element that is in other, erasing one by one when other is smaller and else keeping the rest in a fresh set
+	void difference_with(const HashSet& other)
+	{
+		if(&other == this)
+		{
+			clear();
+			return;
+		}
+		if(other.size() < size())
+		{
+			other.table_.for_each([&](const T& element)
+			{
+				table_.erase(element);
+			});
+			return;
+		}
+
+		HashSet result;
+		result.reserve(size());
+		table_.for_each([&](const T& element)
+		{
+			if(!other.contains(element))
+				result.table_.try_emplace(element, element);
+		});
+		swap(result);
+	}
+
+	template <typename Function>
+	void for_each(Function function) const
+	{
+		table_.for_each(function);
+	}
+
+	// Makes room for count elements so that inserting them never grows the set
+	void reserve(const size_t count)
+	{
+		table_.reserve(count);
+	}
+
+	void clear()
+	{
+		table_.clear();
+	}
+
+	[[nodiscard]] size_t size() const noexcept
+	{
+		return table_.size();
+	}
+
+	[[nodiscard]] bool empty() const noexcept
+	{
+		return table_.size() == 0;
+	}
+
+	[[nodiscard]] size_t capacity() const noexcept
+	{
+		return table_.capacity();
+	}
+
+	[[nodiscard]] ProbeStats probe_stats() const
+	{
+		return table_.probe_stats();
+	}
+
+	bool operator==(const HashSet& other) const
+	{
+		if(size() != other.size()) return false;
+		bool equal = true;
+		table_.for_each([&](const T& element)
+		{
+			equal = equal && other.contains(element);
+		});
+		return equal;
+	}
+
+private:
+	Table table_;
+
+	void add_all(const HashSet& other)
+	{
+		table_.reserve(size() + other.size());
+		other.table_.for_each([&](const T& element)
+		{
+			table_.try_emplace(element, element);
+		});
+	}
+};
+
+#endif // HASHSET_H
@@ -0,0 +1,229 @@
+#ifndef HASHING_H
+#define HASHING_H
+
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+enum
+{
+	// Buckets in ProbeStats::histogram, the last one also counts all longer probes
+	PROBE_HISTOGRAM_SIZE = 16
+};
+
+// Constants of wyhash, odd and with an even mix of set bits
+inline constexpr uint64_t HASH_SECRET[4] = { 0x2d358dccaa6c78a5ull, 0x8bb84b93962eacc9ull, 0x4b33a62ed433d4a3ull, 0x4d5a2da51de1aa47ull };
+
+// Whether a table of T keys can be searched with a K directly, without building a T first.
+// Hash and KeyEqual have to be transparent, and also really accept a K, else the lookup falls back to converting to T
+template <typename K, typename T, typename Hash, typename KeyEqual>
+inline constexpr bool is_transparent_key = requires
+{
+	typename Hash::is_transparent;
+	typename KeyEqual::is_transparent;
+} && std::is_invocable_r_v<size_t, const Hash&, const K&> && std::equality_comparable_with<const T&, const K&>;
+
+// Full 128 bit product of a and b, a gets the low half and b the high half
+inline void multiply_128(uint64_t& a, uint64_t& b) noexcept
+{
+#ifdef __SIZEOF_INT128__
+	__extension__ using Product = unsigned __int128;
+	const Product product = static_cast<Product>(a) * b;
+	a = static_cast<uint64_t>(product);
+	b = static_cast<uint64_t>(product >> 64);
+#else
+	const uint64_t aHigh = a >> 32, aLow = static_cast<uint32_t>(a);
+	const uint64_t bHigh = b >> 32, bLow = static_cast<uint32_t>(b);
+	const uint64_t highHigh = aHigh * bHigh, highLow = aHigh * bLow, lowHigh = aLow * bHigh, lowLow = aLow * bLow;
+	const uint64_t middle = (lowLow >> 32) + static_cast<uint32_t>(highLow) + static_cast<uint32_t>(lowHigh);
+	a = (middle << 32) | static_cast<uint32_t>(lowLow);
+	b = highHigh + (highLow >> 32) + (lowHigh >> 32) + (middle >> 32);
+#endif
+}
+
+// Both halves of the 128 bit product xored together, the mixing step of wyhash
+inline uint64_t multiply_fold(uint64_t a, uint64_t b) noexcept
+{
+	multiply_128(a, b);
+	return a ^ b;
+}
+
+// Spreads the bits of a hash over the whole word. std::hash is the identity for integers on most standard libraries,
+// and the open addressing tables take the slot from some bits and a fingerprint from others, so both have to depend on every input bit.
+// A plain multiply only carries bits upwards, keys that differ in their top bits alone would all share a slot and a fingerprint,
+// folding the high half of the 128 bit product back in lets every input bit reach every output bit
+inline size_t mix_hash(const size_t hash) noexcept
+{
+	return static_cast<size_t>(multiply_fold(static_cast<uint64_t>(hash) ^ HASH_SECRET[0], HASH_SECRET[1]));
+}
+
+// A Hash with a member type is_avalanching promises that every bit of its result already depends on every bit of the key,
+// the tables then use its result directly instead of mixing it once more
+template <typename Hash, typename K>
+size_t table_hash(const Hash& hash, const K& key)
+{
+	if constexpr(requires { typename Hash::is_avalanching; })
+		return hash(key);
+	else
+		return mix_hash(hash(key));
+}
+
+inline uint64_t read_64(const unsigned char* bytes) noexcept
+{
+	uint64_t value;
+	std::memcpy(&value, bytes, sizeof(value));
+	return value;
+}
+
+inline uint64_t read_32(const unsigned char* bytes) noexcept
+{
+	uint32_t value;
+	std::memcpy(&value, bytes, sizeof(value));
+	return value;
+}
+
+// wyhash (final version 4) of length bytes. Short keys take two loads and two multiplies,
+// longer ones are consumed 48 bytes at a time in three independent lanes
+inline uint64_t hash_bytes(const void* data, const size_t length, uint64_t seed = 0) noexcept
+{
+	const unsigned char* bytes = static_cast<const unsigned char*>(data);
+	seed ^= multiply_fold(seed ^ HASH_SECRET[0], HASH_SECRET[1]);
+	uint64_t a;
+	uint64_t b;
+	if(length <= 16)
+	{
+		if(length >= 4)
+		{
+			const size_t shift = (length >> 3) << 2;
+			a = (read_32(bytes) << 32) | read_32(bytes + shift);
+			b = (read_32(bytes + length - 4) << 32) | read_32(bytes + length - 4 - shift);
+		}
+		else if(length > 0)
+		{
+			a = (static_cast<uint64_t>(bytes[0]) << 16) | (static_cast<uint64_t>(bytes[length >> 1]) << 8) | bytes[length - 1];
+			b = 0;
+		}
+		else
+			a = b = 0;
+	}
+	else
+	{
+		size_t left = length;
+		if(left > 48)
+		{
+			uint64_t lane1 = seed;
+			uint64_t lane2 = seed;
+			do
+			{
+				seed = multiply_fold(read_64(bytes) ^ HASH_SECRET[1], read_64(bytes + 8) ^ seed);
+				lane1 = multiply_fold(read_64(bytes + 16) ^ HASH_SECRET[2], read_64(bytes + 24) ^ lane1);
+				lane2 = multiply_fold(read_64(bytes + 32) ^ HASH_SECRET[3], read_64(bytes + 40) ^ lane2);
+				bytes += 48;
+				left -= 48;
+			} while(left > 48);
+			seed ^= lane1 ^ lane2;
+		}
+		while(left > 16)
+		{
+			seed = multiply_fold(read_64(bytes) ^ HASH_SECRET[1], read_64(bytes + 8) ^ seed);
+			bytes += 16;
+			left -= 16;
+		}
+		a = read_64(bytes + left - 16);
+		b = read_64(bytes + left - 8);
+	}
+	a ^= HASH_SECRET[1];
+	b ^= seed;
+	multiply_128(a, b);
+	return multiply_fold(a ^ HASH_SECRET[0] ^ length, b ^ HASH_SECRET[1]);
+}
+
+// Hint to start loading the cache line at address, does nothing on compilers without the builtin
+inline void prefetch_address(const void* address) noexcept
+{
+#if defined(__GNUC__) || defined(__clang__)
+	__builtin_prefetch(address);
+#else
+	(void)address;
+#endif
+}
+
+// Hash the maps use by default: std::hash, except that strings hash transparently,
+// so a map keyed by std::string can be searched with a std::string_view or const char* without building a std::string
+template <typename T>
+struct DefaultHash : std::hash<T> {};
+
+template <>
+struct DefaultHash<std::string>
+{
+	using is_transparent = void;
+
+	size_t operator()(const std::string_view key) const noexcept
+	{
+		return std::hash<std::string_view>()(key);
+	}
+};
+
+// Replacement for std::hash that avalanches by itself, so the tables skip their own mixing step.
+// Integers go through the same folded 128 bit multiply as mix_hash and hash just as well by default,
+// strings go through hash_bytes, which is quicker and stronger than std::hash
+template <typename T>
+struct FastHash
+{
+	static_assert(std::is_integral_v<T> || std::is_enum_v<T>, "FastHash handles integers, enums and strings");
+
+	using is_avalanching = void;
+
+	size_t operator()(const T key) const noexcept
+	{
+		return static_cast<size_t>(multiply_fold(static_cast<uint64_t>(key) ^ HASH_SECRET[0], HASH_SECRET[1]));
+	}
+};
+
+template <>
+struct FastHash<std::string>
+{
+	using is_transparent = void;
+	using is_avalanching = void;
+
+	size_t operator()(const std::string_view key) const noexcept
+	{
+		return static_cast<size_t>(hash_bytes(key.data(), key.size()));
+	}
+};
+
+template <>
+struct FastHash<std::string_view> : FastHash<std::string> {};
+
+// Probe lengths of the elements in a table, 1 meaning an element sits in the first place a lookup of it looks.
+// A step is a group of 16 slots for SwissLayout and a single slot for RobinHoodLayout,
+// long probes or a long tail in the histogram mean the keys hash badly
+struct ProbeStats
+{
+	size_t elements = 0;
+	size_t capacity = 0;
+	size_t longest = 0;
+	size_t total = 0;
+	// histogram[i] counts the elements with probe length i + 1
+	size_t histogram[PROBE_HISTOGRAM_SIZE] = {};
+
+	void record(const size_t length) noexcept
+	{
+		elements++;
+		total += length;
+		if(length > longest) longest = length;
+		histogram[(length < PROBE_HISTOGRAM_SIZE ? length : static_cast<size_t>(PROBE_HISTOGRAM_SIZE)) - 1]++;
+	}
+
+	[[nodiscard]] double average() const noexcept
+	{
+		return elements == 0 ? 0.0 : static_cast<double>(total) / static_cast<double>(elements);
+	}
+};
+
+#endif // HASHING_H
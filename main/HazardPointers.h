@@ -0,0 +1,189 @@
+#ifndef HAZARD_POINTERS_H
+#define HAZARD_POINTERS_H
+
+#include <atomic>
+#include <vector>
+#include <mutex>
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include "CacheLine.h"
+
+enum
+{
+	HAZARD_MAX_THREADS = 128,
+	HAZARD_SLOTS = 2,
+	// Retired nodes are only scanned for once a thread holds this many
+	HAZARD_RETIRE_THRESHOLD = 2 * HAZARD_MAX_THREADS * HAZARD_SLOTS
+};
+
+// Safe memory reclamation for the lock-free containers.
+// A thread publishes the nodes it is about to dereference in its hazard slots, removed nodes are retired
+// instead of deleted and only freed once no slot of any thread points at them anymore.
+// Because a protected node can not be freed, it can also not be reallocated, which rules out ABA on protected pointers.
+class HazardPointers
+{
+	struct alignas(CACHE_LINE_SIZE) Record
+	{
+		std::atomic<bool> active;
+		std::atomic<void*> slots[HAZARD_SLOTS];
+	};
+
+	struct Retired
+	{
+		void* ptr;
+		void (*deleter)(void*);
+	};
+
+	// Retired nodes left behind by threads that exited while the nodes were still protected
+	struct Orphans
+	{
+		std::mutex mutex;
+		std::vector<Retired> list;
+		std::atomic<bool> pending;
+
+		~Orphans()
+		{
+			for(const Retired& retired : list)
+				retired.deleter(retired.ptr);
+		}
+	};
+
+	struct ThreadState
+	{
+		Record* record;
+		std::vector<Retired> retired;
+
+		ThreadState() : record(acquire_record()) {}
+
+		~ThreadState()
+		{
+			for(std::atomic<void*>& slot : record->slots)
+				slot.store(nullptr, std::memory_order_release);
+			scan(retired);
+			if(!retired.empty())
+			{
+				std::lock_guard<std::mutex> lock(orphans_.mutex);
+				orphans_.list.insert(orphans_.list.end(), retired.begin(), retired.end());
+				orphans_.pending.store(true, std::memory_order_release);
+			}
+			record->active.store(false, std::memory_order_release);
+		}
+	};
+
+public:
+	HazardPointers() = delete;
+
+	// Publishes the current value of source in the slot, and returns it once it is known to still be current
+	template <typename N>
+	static N* protect(const size_t slot, const std::atomic<N*>& source) noexcept
+	{
+		std::atomic<void*>& hazard = local().record->slots[slot];
+		N* ptr = source.load(std::memory_order_relaxed);
+		while(true)
+		{
+			hazard.store(ptr, std::memory_order_seq_cst);
+			N* current = source.load(std::memory_order_seq_cst);
+			if(current == ptr) return ptr;
+			ptr = current;
+		}
+	}
+
+	// Publishes a pointer the calling thread already knows to be alive, such as a node it allocated itself
+	static void set(const size_t slot, void* ptr) noexcept
+	{
+		local().record->slots[slot].store(ptr, std::memory_order_seq_cst);
+	}
+
+	static void clear(const size_t slot) noexcept
+	{
+		local().record->slots[slot].store(nullptr, std::memory_order_release);
+	}
+
+	// Hands over a node that is no longer reachable, it is deleted once no thread protects it
+	template <typename N>
+	static void retire(N* ptr)
+	{
+		retire(ptr, [](void* p) { delete static_cast<N*>(p); });
+	}
+
+	// Same as above, but lets the container decide what happens to the node, such as putting it back in a pool
+	static void retire(void* ptr, void (*deleter)(void*))
+	{
+		ThreadState& state = local();
+		state.retired.push_back(Retired{ ptr, deleter });
+		if(state.retired.size() >= HAZARD_RETIRE_THRESHOLD)
+			scan(state.retired);
+	}
+
+	// Frees every retired node of the calling thread that is no longer protected
+	static void reclaim()
+	{
+		scan(local().retired);
+	}
+
+private:
+	static inline Record records_[HAZARD_MAX_THREADS]{};
+	static inline std::atomic<size_t> used_records_{ 0 };
+	static inline Orphans orphans_{};
+
+	static ThreadState& local()
+	{
+		thread_local ThreadState state;
+		return state;
+	}
+
+	static Record* acquire_record()
+	{
+		for(size_t i = 0; i < HAZARD_MAX_THREADS; i++)
+		{
+			bool expected = false;
+			if(records_[i].active.load(std::memory_order_relaxed) || !records_[i].active.compare_exchange_strong(expected, true, std::memory_order_acquire))
+				continue;
+
+			size_t used = used_records_.load(std::memory_order_relaxed);
+			while(used <= i && !used_records_.compare_exchange_weak(used, i + 1, std::memory_order_release));
+			return &records_[i];
+		}
+
+		throw std::runtime_error("More than " + std::to_string(HAZARD_MAX_THREADS) + " threads are using hazard pointers");
+	}
+
+	static void scan(std::vector<Retired>& retired)
+	{
+		if(orphans_.pending.load(std::memory_order_acquire))
+		{
+			std::lock_guard<std::mutex> lock(orphans_.mutex);
+			retired.insert(retired.end(), orphans_.list.begin(), orphans_.list.end());
+			orphans_.list.clear();
+			orphans_.pending.store(false, std::memory_order_relaxed);
+		}
+		if(retired.empty()) return;
+
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		std::vector<void*> hazards;
+		const size_t used = used_records_.load(std::memory_order_acquire);
+		for(size_t i = 0; i < used; i++)
+		{
+			for(const std::atomic<void*>& slot : records_[i].slots)
+			{
+				void* ptr = slot.load(std::memory_order_seq_cst);
+				if(ptr != nullptr)
+					hazards.push_back(ptr);
+			}
+		}
+		std::sort(hazards.begin(), hazards.end());
+
+		size_t kept = 0;
+		for(const Retired& entry : retired)
+		{
+			if(std::binary_search(hazards.begin(), hazards.end(), entry.ptr))
+				retired[kept++] = entry;
+			else
+				entry.deleter(entry.ptr);
+		}
+		retired.resize(kept);
+	}
+};
+
+#endif // HAZARD_POINTERS_H
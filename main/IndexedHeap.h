@@ -0,0 +1,247 @@
+#ifndef INDEXED_HEAP_H
+#define INDEXED_HEAP_H
+
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include "List.h"
+
+// Addressable d-ary heap, every push hands out a handle that can later change or erase that element in O(log n).
+// Unlike PriorityQueue the smallest element by Compare is on top, which is what Dijkstra and deadline scheduling want,
+// so decrease_key moves an element towards the top and increase_key away from it.
+// A handle stays valid until its element is popped or erased, after that it may be handed out again.
+template <typename T, typename Compare = std::less<T>, size_t Arity = 2>
+class IndexedHeap
+{
+	static_assert(!std::is_pointer_v<T>, "Attempted to make an IndexedHeap with a raw pointer type");
+	static_assert(std::is_default_constructible_v<T>, "Attempted to make an IndexedHeap with a type that does not implement a default constructor");
+	static_assert(Arity >= 2, "IndexedHeap arity must be at least 2");
+
+	// Marks a handle that is not in the heap
+	static constexpr size_t NO_POSITION = static_cast<size_t>(-1);
+
+	struct Entry
+	{
+		T data;
+		size_t handle;
+	};
+
+public:
+	using Handle = size_t;
+
+	explicit IndexedHeap(Compare comp = Compare()) : comp_(std::move(comp)) {}
+
+	~IndexedHeap() = default;
+
+	IndexedHeap(const IndexedHeap& other) = default;
+	IndexedHeap& operator=(const IndexedHeap& other) = default;
+	IndexedHeap(IndexedHeap&& other) noexcept = default;
+	IndexedHeap& operator=(IndexedHeap&& other) noexcept = default;
+
+	void swap(IndexedHeap& other) noexcept
+	{
+		heap_.swap(other.heap_);
+		positions_.swap(other.positions_);
+		free_handles_.swap(other.free_handles_);
+		std::swap(comp_, other.comp_);
+	}
+
+	friend void swap(IndexedHeap& a, IndexedHeap& b) noexcept
+	{
+		a.swap(b);
+	}
+
+	Handle push(const T& data)
+	{
+		return emplace(data);
+	}
+
+	Handle push(T&& data)
+	{
+		return emplace(std::move(data));
+	}
+
+	template <typename... Args>
+	Handle emplace(Args&&... args)
+	{
+		const Handle handle = acquire_handle();
+		heap_.append(Entry{ T(std::forward<Args>(args)...), handle });
+		const size_t index = heap_.size() - 1;
+		sift_up(index, std::move(heap_[index]));
+		return handle;
+	}
+
+	[[nodiscard]] const T& top() const
+	{
+		if(empty())
+		{
+			throw std::out_of_range("IndexedHeap is empty");
+		}
+		return heap_[0].data;
+	}
+
+	[[nodiscard]] Handle top_handle() const
+	{
+		if(empty())
+		{
+			throw std::out_of_range("IndexedHeap is empty");
+		}
+		return heap_[0].handle;
+	}
+
+	T pop()
+	{
+		if(empty())
+		{
+			throw std::out_of_range("IndexedHeap is empty");
+		}
+		return remove_at(0);
+	}
+
+	[[nodiscard]] bool contains(const Handle handle) const noexcept
+	{
+		return handle < positions_.size() && positions_[handle] != NO_POSITION;
+	}
+
+	[[nodiscard]] const T& get(const Handle handle) const
+	{
+		return heap_[position_of(handle)].data;
+	}
+
+	// Removes the element behind handle and returns it
+	T erase(const Handle handle)
+	{
+		return remove_at(position_of(handle));
+	}
+
+	// The new value may not order after the current one
+	void decrease_key(const Handle handle, T data)
+	{
+		const size_t index = position_of(handle);
+		if(comp_(heap_[index].data, data)) throw std::invalid_argument("decrease_key was given a value that orders after the current one");
+		sift_up(index, Entry{ std::move(data), handle });
+	}
+
+	// The new value may not order before the current one
+	void increase_key(const Handle handle, T data)
+	{
+		const size_t index = position_of(handle);
+		if(comp_(data, heap_[index].data)) throw std::invalid_argument("increase_key was given a value that orders before the current one");
+		sift_down(index, Entry{ std::move(data), handle });
+	}
+
+	// Replaces the value behind handle, whichever way it moves
+	void update(const Handle handle, T data)
+	{
+		const size_t index = position_of(handle);
+		if(comp_(data, heap_[index].data))
+			sift_up(index, Entry{ std::move(data), handle });
+		else
+			sift_down(index, Entry{ std::move(data), handle });
+	}
+
+	void clear()
+	{
+		heap_.clear();
+		positions_.clear();
+		free_handles_.clear();
+	}
+
+	[[nodiscard]] size_t size() const noexcept
+	{
+		return heap_.size();
+	}
+
+	[[nodiscard]] bool empty() const noexcept
+	{
+		return heap_.empty();
+	}
+
+private:
+	List<Entry, true> heap_;
+	// Heap index of every handle, NO_POSITION for handles that are free
+	List<size_t, true> positions_;
+	List<size_t, true> free_handles_;
+	Compare comp_;
+
+	[[nodiscard]] size_t position_of(const Handle handle) const
+	{
+		if(!contains(handle)) throw std::out_of_range("Handle is not in the heap: " + std::to_string(handle));
+		return positions_[handle];
+	}
+
+	Handle acquire_handle()
+	{
+		if(!free_handles_.empty()) return free_handles_.pop_back();
+		positions_.append(NO_POSITION);
+		return positions_.size() - 1;
+	}
+
+	// Fills the hole at index with the last entry and restores the heap around it
+	T remove_at(const size_t index)
+	{
+		Entry last = heap_.pop_back();
+		if(index == heap_.size())
+		{
+			release_handle(last.handle);
+			return std::move(last.data);
+		}
+
+		release_handle(heap_[index].handle);
+		T res = std::move(heap_[index].data);
+		if(index > 0 && comp_(last.data, heap_[(index - 1) / Arity].data))
+			sift_up(index, std::move(last));
+		else
+			sift_down(index, std::move(last));
+		return res;
+	}
+
+	void release_handle(const Handle handle)
+	{
+		positions_[handle] = NO_POSITION;
+		free_handles_.append(handle);
+	}
+
+	void place(const size_t index, Entry&& entry)
+	{
+		positions_[entry.handle] = index;
+		heap_[index] = std::move(entry);
+	}
+
+	// Moves entry up from the hole at index while it orders before its parent
+	void sift_up(size_t index, Entry entry)
+	{
+		while(index > 0)
+		{
+			const size_t parent = (index - 1) / Arity;
+			if(!comp_(entry.data, heap_[parent].data)) break;
+			place(index, std::move(heap_[parent]));
+			index = parent;
+		}
+		place(index, std::move(entry));
+	}
+
+	// Moves entry down from the hole at index while a child orders before it
+	void sift_down(size_t index, Entry entry)
+	{
+		const size_t size = heap_.size();
+		while(true)
+		{
+			const size_t first = index * Arity + 1;
+			if(first >= size) break;
+
+			const size_t last = first + Arity < size ? first + Arity : size;
+			size_t best = first;
+			for(size_t child = first + 1; child < last; child++)
+				if(comp_(heap_[child].data, heap_[best].data)) best = child;
+
+			if(!comp_(heap_[best].data, entry.data)) break;
+			place(index, std::move(heap_[best]));
+			index = best;
+		}
+		place(index, std::move(entry));
+	}
+};
+
+#endif // INDEXED_HEAP_H
@@ -7,6 +7,7 @@
 #include <string>
 #include "TypeTraitsCheck.h"
 #include <memory>
+#include <utility>
 
 // Percentage of the internal array that is populated
 enum
@@ -23,6 +24,8 @@ template <typename T, bool = std::is_arithmetic_v<T>>
 class List
 {
 public:
+	using value_type = T;
+
 	class Iterator
 	{
 	public:
@@ -188,6 +191,18 @@ public:
 		return *this;
 	}
 
+	void swap(List& other) noexcept
+	{
+		std::swap(ptr_, other.ptr_);
+		std::swap(count_, other.count_);
+		std::swap(elements_, other.elements_);
+	}
+
+	friend void swap(List& a, List& b) noexcept
+	{
+		a.swap(b);
+	}
+
 	template <typename U = T, std::enable_if_t<is_printable<U>::value, int> = 0>
 	friend std::ostream& operator<<(std::ostream& os, const List& list)
 	{
@@ -218,6 +233,13 @@ public:
 		throw std::out_of_range("Index out of bounds\nindex: " + std::to_string(index) + "\nsize: " + std::to_string(elements_));
 	}
 
+	const T& operator[](size_t index) const
+	{
+		if(index < elements_) return ptr_[index];
+
+		throw std::out_of_range("Index out of bounds\nindex: " + std::to_string(index) + "\nsize: " + std::to_string(elements_));
+	}
+
 	[[nodiscard]] T at(size_t index) const
 	{
 		if(index < elements_) return ptr_[index];
@@ -276,6 +298,24 @@ public:
 		elements_++;
 	}
 
+	template <typename... Args>
+	T& emplace_back(Args&&... args)
+	{
+		append(T(std::forward<Args>(args)...));
+		return ptr_[elements_ - 1];
+	}
+
+	// Same as append, lets std::back_inserter fill a List
+	void push_back(const T& data)
+	{
+		append(data);
+	}
+
+	void push_back(T&& data)
+	{
+		append(std::move(data));
+	}
+
 	void insert_at(const T& data, const size_t index)
 	{
 		if(index < elements_)
@@ -333,27 +373,41 @@ public:
 	{
 		if(index < elements_)
 		{
-			if(count_ > MINIMUM_SIZE && elements_ * 100 <= DOWNSIZE_THRESHOLD * count_)
-			{
-				const size_t temp = count_ * SHRINK_FACTOR / 100;
-				count_ = temp < MINIMUM_SIZE ? MINIMUM_SIZE : temp;
-				T* tempptr = new T[count_];
-				for(size_t i = 0; i < elements_; i++)
-					tempptr[i] = std::move(ptr_[i]);
-				for(size_t i = elements_; i < count_; i++)
-					tempptr[i] = T();
-				delete[] ptr_;
-				ptr_ = tempptr;
-			}
-			for(size_t i = index; i < elements_; i++)
+			shrink_if_sparse();
+			for(size_t i = index; i + 1 < elements_; i++)
 				ptr_[i] = std::move(ptr_[i + 1]);
 			elements_--;
+			ptr_[elements_] = T();
 			return;
 		}
 
 		throw std::out_of_range("Index out of bounds\nindex: " + std::to_string(index) + "\nsize: " + std::to_string(elements_));
 	}
 
+	[[nodiscard]] T& back()
+	{
+		if(elements_ > 0) return ptr_[elements_ - 1];
+		throw std::out_of_range("List is empty");
+	}
+
+	[[nodiscard]] const T& back() const
+	{
+		if(elements_ > 0) return ptr_[elements_ - 1];
+		throw std::out_of_range("List is empty");
+	}
+
+	// Removes the last element without shifting anything
+	T pop_back()
+	{
+		if(elements_ == 0) throw std::out_of_range("List is empty");
+
+		shrink_if_sparse();
+		elements_--;
+		T res = std::move(ptr_[elements_]);
+		ptr_[elements_] = T();
+		return res;
+	}
+
 	void clear() noexcept
 	{
 		delete[] ptr_;
@@ -362,6 +416,23 @@ public:
 		elements_ = 0;
 	}
 
+	// Grows the array so that the list can hold size elements without growing again
+	void reserve(const size_t size)
+	{
+		const size_t temp = size * 100 / UPSIZE_THRESHOLD + 1;
+		const size_t capacity = temp < MINIMUM_SIZE ? MINIMUM_SIZE : temp;
+		if(ptr_ != nullptr && capacity <= count_) return;
+
+		T* tempptr = new T[capacity];
+		for(size_t i = 0; i < elements_; i++)
+			tempptr[i] = std::move(ptr_[i]);
+		for(size_t i = elements_; i < capacity; i++)
+			tempptr[i] = T();
+		delete[] ptr_;
+		ptr_ = tempptr;
+		count_ = capacity;
+	}
+
 	void resize(const size_t size, const bool allowSmaller = false)
 	{
 		if(size == 0) throw std::invalid_argument("Size must be larger than 0");
@@ -393,15 +464,31 @@ private:
 	size_t count_;
 	size_t elements_;
 	T* ptr_;
+
+	void shrink_if_sparse()
+	{
+		if(count_ <= MINIMUM_SIZE || elements_ * 100 > DOWNSIZE_THRESHOLD * count_) return;
+
+		const size_t temp = count_ * SHRINK_FACTOR / 100;
+		count_ = temp < MINIMUM_SIZE ? MINIMUM_SIZE : temp;
+		T* tempptr = new T[count_];
+		for(size_t i = 0; i < elements_; i++)
+			tempptr[i] = std::move(ptr_[i]);
+		for(size_t i = elements_; i < count_; i++)
+			tempptr[i] = T();
+		delete[] ptr_;
+		ptr_ = tempptr;
+	}
 };
 
 template <typename T>
 class List<T, false>
 {
 	static_assert(std::is_default_constructible_v<T>, "Attempted to make a List with a type that does not implement a default constructor");
-	static_assert(std::is_copy_constructible_v<T>, "Attempted to make a List with a type that does not implement a copy constructor");
 	static_assert(!std::is_pointer_v<T>, "Attempted to make a List with a raw pointer type");
 public:
+	using value_type = T;
+
 	class Iterator
 	{
 	public:
@@ -483,7 +570,7 @@ public:
 		const size_t temp = elements_ * STARTING_SIZE / 100;
 		count_ = temp < MINIMUM_SIZE ? MINIMUM_SIZE : temp;
 		ptr_ = new T*[count_];
-		const T* p = data.data();
+		T* p = data.data();
 		for(int i = 0; i < N; i++)
 			ptr_[i] = new T(std::move(p[i]));
 		for(size_t i = elements_; i < count_; i++)
@@ -522,14 +609,14 @@ public:
 		ptr_ = nullptr;
 	}
 
-	List(const List& other) : count_(other.count_), elements_(other.elements_)
+	List(const List& other) requires std::is_copy_constructible_v<T> : count_(other.count_), elements_(other.elements_)
 	{
 		ptr_ = new T * [count_];
 		for(size_t i = 0; i < elements_; ++i)
 			ptr_[i] = new T(*(other.ptr_[i]));
 	}
 
-	List& operator=(const List& other)
+	List& operator=(const List& other) requires std::is_copy_constructible_v<T>
 	{
 		if(this == &other) return* this;
 
@@ -571,6 +658,18 @@ public:
 		return *this;
 	}
 
+	void swap(List& other) noexcept
+	{
+		std::swap(ptr_, other.ptr_);
+		std::swap(count_, other.count_);
+		std::swap(elements_, other.elements_);
+	}
+
+	friend void swap(List& a, List& b) noexcept
+	{
+		a.swap(b);
+	}
+
 	template <typename U = T, std::enable_if_t<is_printable<U>::value, int> = 0>
 	friend std::ostream& operator<<(std::ostream& os, const List& list)
 	{
@@ -601,6 +700,13 @@ public:
 		throw std::out_of_range("Index out of bounds\nindex: " + std::to_string(index) + "\nsize: " + std::to_string(elements_));
 	}
 
+	const T& operator[](size_t index) const
+	{
+		if(index < elements_) return *ptr_[index];
+
+		throw std::out_of_range("Index out of bounds\nindex: " + std::to_string(index) + "\nsize: " + std::to_string(elements_));
+	}
+
 	[[nodiscard]] T at(size_t index) const
 	{
 		if(index < elements_) return *ptr_[index];
@@ -609,6 +715,17 @@ public:
 	}
 
 	void append(const T& data) noexcept
+	{
+		emplace_back(data);
+	}
+
+	void append(T&& data) noexcept
+	{
+		emplace_back(std::move(data));
+	}
+
+	template <typename... Args>
+	T& emplace_back(Args&&... args)
 	{
 		if(ptr_ == nullptr)
 		{
@@ -630,34 +747,19 @@ public:
 			ptr_ = tempptr;
 		}
 
-		ptr_[elements_] = new T(data);
-		elements_++;
+		ptr_[elements_] = new T(std::forward<Args>(args)...);
+		return *ptr_[elements_++];
 	}
 
-	void append(T&& data) noexcept
+	// Same as append, lets std::back_inserter fill a List
+	void push_back(const T& data)
 	{
-		if(ptr_ == nullptr)
-		{
-			ptr_ = new T * [MINIMUM_SIZE];
-			count_ = MINIMUM_SIZE;
-			for(char i = 0; i < MINIMUM_SIZE; i++)
-				ptr_[i] = nullptr;
-		}
-		else if(elements_ * 100 >= UPSIZE_THRESHOLD * count_)
-		{
-			const size_t temp = GROWTH_FACTOR * count_ / 100;
-			count_ = temp < MINIMUM_SIZE ? MINIMUM_SIZE : temp;
-			T** tempptr = new T * [count_];
-			for(size_t i = 0; i < elements_; i++)
-				tempptr[i] = ptr_[i];
-			for(size_t i = elements_; i < count_; i++)
-				tempptr[i] = nullptr;
-			delete[] ptr_;
-			ptr_ = tempptr;
-		}
+		emplace_back(data);
+	}
 
-		ptr_[elements_] = new T(std::move(data));
-		elements_++;
+	void push_back(T&& data)
+	{
+		emplace_back(std::move(data));
 	}
 
 	void insert_at(const T& data, size_t index)
@@ -716,28 +818,43 @@ public:
 	{
 		if(index < elements_)
 		{
-			if(count_ > MINIMUM_SIZE && elements_ * 100 <= DOWNSIZE_THRESHOLD * count_)
-			{
-				const size_t temp = count_ * SHRINK_FACTOR / 100;
-				count_ = temp < MINIMUM_SIZE ? MINIMUM_SIZE : temp;
-				T** tempptr = new T*[count_];
-				for(size_t i = 0; i < elements_; i++)
-					tempptr[i] = ptr_[i];
-				for(size_t i = elements_; i < count_; i++)
-					tempptr[i] = nullptr;
-				delete[] ptr_;
-				ptr_ = tempptr;
-			}
+			shrink_if_sparse();
 			delete ptr_[index];
-			for(size_t i = index; i < elements_; i++)
-					ptr_[i] = ptr_[i + 1];
+			for(size_t i = index; i + 1 < elements_; i++)
+				ptr_[i] = ptr_[i + 1];
 			elements_--;
+			ptr_[elements_] = nullptr;
 			return;
 		}
 
 		throw std::out_of_range("Index out of bounds\nindex: " + std::to_string(index) + "\nsize: " + std::to_string(elements_));
 	}
 
+	[[nodiscard]] T& back()
+	{
+		if(elements_ > 0) return *ptr_[elements_ - 1];
+		throw std::out_of_range("List is empty");
+	}
+
+	[[nodiscard]] const T& back() const
+	{
+		if(elements_ > 0) return *ptr_[elements_ - 1];
+		throw std::out_of_range("List is empty");
+	}
+
+	// Removes the last element without shifting anything
+	T pop_back()
+	{
+		if(elements_ == 0) throw std::out_of_range("List is empty");
+
+		shrink_if_sparse();
+		elements_--;
+		T res = std::move(*ptr_[elements_]);
+		delete ptr_[elements_];
+		ptr_[elements_] = nullptr;
+		return res;
+	}
+
 	void clear() noexcept
 	{
 		for(size_t i = 0; i < count_; i++)
@@ -748,6 +865,23 @@ public:
 		elements_ = 0;
 	}
 
+	// Grows the array so that the list can hold size elements without growing again
+	void reserve(const size_t size)
+	{
+		const size_t temp = size * 100 / UPSIZE_THRESHOLD + 1;
+		const size_t capacity = temp < MINIMUM_SIZE ? MINIMUM_SIZE : temp;
+		if(ptr_ != nullptr && capacity <= count_) return;
+
+		T** tempptr = new T*[capacity];
+		for(size_t i = 0; i < elements_; i++)
+			tempptr[i] = ptr_[i];
+		for(size_t i = elements_; i < capacity; i++)
+			tempptr[i] = nullptr;
+		delete[] ptr_;
+		ptr_ = tempptr;
+		count_ = capacity;
+	}
+
 	void resize(const size_t size, const bool allowSmaller = false)
 	{
 		if(size == 0) throw std::invalid_argument("size must be larger than 0");
@@ -786,5 +920,20 @@ private:
 	size_t count_;
 	size_t elements_;
 	T** ptr_;
+
+	void shrink_if_sparse()
+	{
+		if(count_ <= MINIMUM_SIZE || elements_ * 100 > DOWNSIZE_THRESHOLD * count_) return;
+
+		const size_t temp = count_ * SHRINK_FACTOR / 100;
+		count_ = temp < MINIMUM_SIZE ? MINIMUM_SIZE : temp;
+		T** tempptr = new T*[count_];
+		for(size_t i = 0; i < elements_; i++)
+			tempptr[i] = ptr_[i];
+		for(size_t i = elements_; i < count_; i++)
+			tempptr[i] = nullptr;
+		delete[] ptr_;
+		ptr_ = tempptr;
+	}
 };
 #endif // LIST_H
\ No newline at end of file
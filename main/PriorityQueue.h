@@ -0,0 +1,169 @@
+#ifndef PRIORITY_QUEUE_H
+#define PRIORITY_QUEUE_H
+
+#include <vector>
+#include <functional>
+#include <stdexcept>
+#include <utility>
+#include "List.h"
+#include "TypeTraitsCheck.h"
+
+// Implicit d-ary heap on one contiguous List, with std::less the largest element is on top.
+// A higher Arity makes the heap shallower, so pushes compare less and a pop touches fewer cache lines going down,
+// at the cost of comparing more children per level.
+template <typename T, typename Compare = std::less<T>, size_t Arity = 2>
+class PriorityQueue
+{
+	static_assert(!std::is_pointer_v<T>, "Attempted to make a PriorityQueue with a raw pointer type");
+	static_assert(std::is_default_constructible_v<T>, "Attempted to make a PriorityQueue with a type that does not implement a default constructor");
+	static_assert(Arity >= 2, "PriorityQueue arity must be at least 2");
+
+public:
+	explicit PriorityQueue(Compare comp = Compare()) : comp_(std::move(comp)) {}
+
+	// Builds the heap bottom up in O(n)
+	template <typename InputIt>
+	PriorityQueue(InputIt first, InputIt last, Compare comp = Compare()) : comp_(std::move(comp))
+	{
+		for(; first != last; ++first)
+			list_.append(*first);
+		heapify();
+	}
+
+	explicit PriorityQueue(std::vector<T> data, Compare comp = Compare()) : comp_(std::move(comp))
+	{
+		list_.reserve(data.size());
+		for(T& element : data)
+			list_.append(std::move(element));
+		heapify();
+	}
+
+	PriorityQueue(std::initializer_list<T> data, Compare comp = Compare()) : PriorityQueue(data.begin(), data.end(), std::move(comp)) {}
+
+	~PriorityQueue() = default;
+
+	PriorityQueue(const PriorityQueue& other) = default;
+	PriorityQueue& operator=(const PriorityQueue& other) = default;
+	PriorityQueue(PriorityQueue&& other) noexcept = default;
+	PriorityQueue& operator=(PriorityQueue&& other) noexcept = default;
+
+	void swap(PriorityQueue& other) noexcept
+	{
+		list_.swap(other.list_);
+		std::swap(comp_, other.comp_);
+	}
+
+	friend void swap(PriorityQueue& a, PriorityQueue& b) noexcept
+	{
+		a.swap(b);
+	}
+
+	void push(const T& data)
+	{
+		list_.append(data);
+		sift_up(list_.size() - 1);
+	}
+
+	void push(T&& data)
+	{
+		list_.append(std::move(data));
+		sift_up(list_.size() - 1);
+	}
+
+	template <typename... Args>
+	void emplace(Args&&... args)
+	{
+		list_.emplace_back(std::forward<Args>(args)...);
+		sift_up(list_.size() - 1);
+	}
+
+	// The element can not be changed in place, that could break the heap
+	[[nodiscard]] const T& top() const
+	{
+		if(empty())
+		{
+			throw std::out_of_range("PriorityQueue is empty");
+		}
+		return list_[0];
+	}
+
+	T pop()
+	{
+		if(empty())
+		{
+			throw std::out_of_range("PriorityQueue is empty");
+		}
+
+		T last = list_.pop_back();
+		if(list_.empty()) return last;
+
+		T res = std::move(list_[0]);
+		sift_down(0, std::move(last));
+		return res;
+	}
+
+	void clear()
+	{
+		list_.clear();
+	}
+
+	[[nodiscard]] size_t size() const noexcept
+	{
+		return list_.size();
+	}
+
+	[[nodiscard]] bool empty() const noexcept
+	{
+		return list_.empty();
+	}
+
+private:
+	List<T, true> list_;
+	Compare comp_;
+
+	void heapify()
+	{
+		const size_t size = list_.size();
+		if(size < 2) return;
+
+		for(size_t i = (size - 2) / Arity + 1; i > 0; i--)
+			sift_down(i - 1, std::move(list_[i - 1]));
+	}
+
+	// Moves the element at index up until its parent is not lower, shifting parents down instead of swapping
+	void sift_up(size_t index)
+	{
+		T value = std::move(list_[index]);
+		while(index > 0)
+		{
+			const size_t parent = (index - 1) / Arity;
+			if(!comp_(list_[parent], value)) break;
+			list_[index] = std::move(list_[parent]);
+			index = parent;
+		}
+		list_[index] = std::move(value);
+	}
+
+	// Drops value into the hole at index, lifting the highest child while it is higher than value
+	void sift_down(size_t index, T value)
+	{
+		const size_t size = list_.size();
+		while(true)
+		{
+			const size_t first = index * Arity + 1;
+			if(first >= size) break;
+
+			const size_t last = first + Arity < size ? first + Arity : size;
+			size_t best = first;
+			for(size_t child = first + 1; child < last; child++)
+				if(comp_(list_[best], list_[child])) best = child;
+
+			if(!comp_(value, list_[best])) break;
+			list_[index] = std::move(list_[best]);
+			index = best;
+		}
+		list_[index] = std::move(value);
+	}
+};
+
+#endif // PRIORITY_QUEUE_H
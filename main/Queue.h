@@ -4,31 +4,32 @@
 #include <array>
 #include <vector>
 #include <stdexcept>
+#include <iterator>
 #include "TypeTraitsCheck.h"
+#include "List.h"
 #include "DLinkedList.h"
 
 template<typename T>
 class Queue
 {
-	static_assert(std::is_copy_constructible_v<T>, "Attempted to make a Queue with a type that does not implement a copy constructor");
 	static_assert(!std::is_pointer_v<T>, "Attempted to make a Queue with a raw pointer type");
 public:
 	Queue() : list_(DLinkedList<T>()) {}
 
 	explicit Queue(T data[], const size_t size) : list_(DLinkedList<T>(data,size)) {}
 
-	explicit Queue(std::vector<T> data) : list_(DLinkedList<T>(data)) {}
+	explicit Queue(std::vector<T> data) : list_(DLinkedList<T>(std::move(data))) {}
 
 	template <size_t N>
-	explicit Queue(std::array<T, N> data) : list_(DLinkedList<T>(data)) {}
+	explicit Queue(std::array<T, N> data) : list_(DLinkedList<T>(std::move(data))) {}
 
 	explicit Queue(std::initializer_list<T> data) : list_(DLinkedList<T>(data)) {}
 
 	~Queue() = default;
 
-	Queue(const Queue& other) : list_(DLinkedList<T>(other.list_)) {}
+	Queue(const Queue& other) requires std::is_copy_constructible_v<T> : list_(DLinkedList<T>(other.list_)) {}
 
-	Queue& operator=(const Queue& other)
+	Queue& operator=(const Queue& other) requires std::is_copy_constructible_v<T>
 	{
 		if(this == &other) return *this;
 
@@ -38,21 +39,28 @@ public:
 		return *this;
 	}
 
-	Queue(Queue&& other) noexcept
-	{
-		list_ = other.list_;
-	}
+	// Takes over the nodes of other, which is left empty
+	Queue(Queue&& other) noexcept : list_(std::move(other.list_)) {}
 
 	Queue& operator=(Queue&& other) noexcept
 	{
 		if(this == &other) return *this;
 
-		clear();
-		list_ = other.list_;
+		list_ = std::move(other.list_);
 
 		return *this;
 	}
 
+	void swap(Queue& other) noexcept
+	{
+		list_.swap(other.list_);
+	}
+
+	friend void swap(Queue& a, Queue& b) noexcept
+	{
+		a.swap(b);
+	}
+
 	template <typename U = T, std::enable_if_t<is_printable<U>::value, int> = 0>
 	friend std::ostream& operator<<(std::ostream& os, const Queue& stack)
 	{
@@ -71,16 +79,25 @@ public:
 	{
 		if(empty())
 		{
-			throw std::out_of_range("Stack is empty");
+			throw std::out_of_range("Queue is empty");
 		}
 		return list_.pop_front();
 	}
 
-	[[nodiscard]] T peek() const
+	[[nodiscard]] T& peek()
+	{
+		if(empty())
+		{
+			throw std::out_of_range("Queue is empty");
+		}
+		return list_.front();
+	}
+
+	[[nodiscard]] const T& peek() const
 	{
 		if(empty())
 		{
-			throw std::out_of_range("Stack is empty");
+			throw std::out_of_range("Queue is empty");
 		}
 		return list_.front();
 	}
@@ -89,6 +106,39 @@ public:
 	{
 		list_.append(data);
 	}
+
+	void push(T&& data)
+	{
+		list_.append(std::move(data));
+	}
+
+	template <typename... Args>
+	void emplace(Args&&... args)
+	{
+		list_.emplace_back(std::forward<Args>(args)...);
+	}
+
+	// Pushes first..last in order
+	template <typename InputIt>
+	void push_range(InputIt first, InputIt last)
+	{
+		list_.append_range(first, last);
+	}
+
+	// Moves up to n elements into out, front first, returns how many were popped instead of throwing when the queue runs empty
+	template <typename OutputIt>
+	size_t pop_n(OutputIt out, const size_t n)
+	{
+		return list_.pop_front_n(out, n);
+	}
+
+	// Moves every element to the back of list, front first, and leaves the queue empty
+	void drain_into(List<T>& list)
+	{
+		list.reserve(list.size() + list_.size());
+		pop_n(std::back_inserter(list), list_.size());
+	}
+
 	void clear()
 	{
 		list_.clear();
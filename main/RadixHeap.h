@@ -0,0 +1,166 @@
+#ifndef RADIX_HEAP_H
+#define RADIX_HEAP_H
+
+#include <bit>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include "List.h"
+
+// Monotone priority queue for integer keys, like timestamps: a pushed key may never be lower than the last popped one.
+// Entries sit in one bucket per bit, picked by the highest bit in which their key differs from the last popped key.
+// Popping only redistributes the lowest non-empty bucket, and every entry can only move to lower buckets,
+// so each entry is touched at most once per bit of the key.
+template <typename Key, typename T>
+class RadixHeap
+{
+	static_assert(std::is_integral_v<Key>, "RadixHeap keys have to be integers");
+	static_assert(!std::is_pointer_v<T>, "Attempted to make a RadixHeap with a raw pointer type");
+	static_assert(std::is_default_constructible_v<T>, "Attempted to make a RadixHeap with a type that does not implement a default constructor");
+
+	using Bits = std::make_unsigned_t<Key>;
+
+	enum
+	{
+		KEY_BITS = std::numeric_limits<Bits>::digits
+	};
+
+	struct Entry
+	{
+		Key key;
+		T data;
+	};
+
+public:
+	RadixHeap() : last_(std::numeric_limits<Key>::min()), count_(0) {}
+
+	~RadixHeap() = default;
+
+	RadixHeap(const RadixHeap& other) = default;
+	RadixHeap& operator=(const RadixHeap& other) = default;
+	RadixHeap(RadixHeap&& other) noexcept = default;
+	RadixHeap& operator=(RadixHeap&& other) noexcept = default;
+
+	void swap(RadixHeap& other) noexcept
+	{
+		for(size_t i = 0; i <= KEY_BITS; i++)
+			buckets_[i].swap(other.buckets_[i]);
+		std::swap(last_, other.last_);
+		std::swap(count_, other.count_);
+	}
+
+	friend void swap(RadixHeap& a, RadixHeap& b) noexcept
+	{
+		a.swap(b);
+	}
+
+	void push(const Key key, const T& data)
+	{
+		emplace(key, data);
+	}
+
+	void push(const Key key, T&& data)
+	{
+		emplace(key, std::move(data));
+	}
+
+	template <typename... Args>
+	void emplace(const Key key, Args&&... args)
+	{
+		if(key < last_) throw std::invalid_argument("RadixHeap keys may not be lower than the last popped key");
+		buckets_[bucket_of(key)].append(Entry{ key, T(std::forward<Args>(args)...) });
+		count_++;
+	}
+
+	// Lowest key in the heap, may redistribute a bucket to find it
+	[[nodiscard]] Key top_key()
+	{
+		if(empty())
+		{
+			throw std::out_of_range("RadixHeap is empty");
+		}
+		refill();
+		return last_;
+	}
+
+	// Removes an element with the lowest key, elements with equal keys come out in no particular order
+	T pop()
+	{
+		if(empty())
+		{
+			throw std::out_of_range("RadixHeap is empty");
+		}
+		refill();
+		count_--;
+		return buckets_[0].pop_back().data;
+	}
+
+	// Key of the last popped element, no key lower than this can be pushed
+	[[nodiscard]] Key last_key() const noexcept
+	{
+		return last_;
+	}
+
+	void clear()
+	{
+		for(List<Entry, true>& bucket : buckets_)
+			bucket.clear();
+		last_ = std::numeric_limits<Key>::min();
+		count_ = 0;
+	}
+
+	[[nodiscard]] size_t size() const noexcept
+	{
+		return count_;
+	}
+
+	[[nodiscard]] bool empty() const noexcept
+	{
+		return count_ == 0;
+	}
+
+private:
+	// Bucket 0 only holds keys equal to last_, bucket i keys whose highest bit differing from last_ is bit i - 1
+	List<Entry, true> buckets_[KEY_BITS + 1];
+	Key last_;
+	size_t count_;
+
+	// Flips the sign bit of signed keys so that they order the same as their bits
+	static Bits to_bits(const Key key) noexcept
+	{
+		if constexpr(std::is_signed_v<Key>)
+			return static_cast<Bits>(key) ^ (Bits(1) << (KEY_BITS - 1));
+		else
+			return key;
+	}
+
+	[[nodiscard]] size_t bucket_of(const Key key) const noexcept
+	{
+		return static_cast<size_t>(std::bit_width(static_cast<Bits>(to_bits(key) ^ to_bits(last_))));
+	}
+
+	// Makes sure bucket 0 holds the lowest key, by moving last_ up to the minimum of the first non-empty bucket
+	void refill()
+	{
+		if(!buckets_[0].empty()) return;
+
+		size_t index = 1;
+		while(buckets_[index].empty())
+			index++;
+
+		List<Entry, true>& bucket = buckets_[index];
+		Key minimum = bucket[0].key;
+		for(size_t i = 1; i < bucket.size(); i++)
+			if(bucket[i].key < minimum) minimum = bucket[i].key;
+
+		last_ = minimum;
+		while(!bucket.empty())
+		{
+			Entry entry = bucket.pop_back();
+			buckets_[bucket_of(entry.key)].append(std::move(entry));
+		}
+	}
+};
+
+#endif // RADIX_HEAP_H
@@ -0,0 +1,164 @@
+#ifndef READ_MOSTLY_HASH_MAP_H
+#define READ_MOSTLY_HASH_MAP_H
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include "HashMap.h"
+#include "HazardPointers.h"
+
+// Concurrent map for data that is read far more often than it changes, like configuration or routing tables.
+// Readers never lock: they protect the current HashMap with a hazard pointer in their own slot and search it directly,
+// so reads on different cores share nothing but the pointer to the map, which only changes when a writer publishes.
+// Writers serialize on a mutex, change a copy of the map and publish it whole, the old copy is retired through HazardPointers.
+// Every write therefore costs a copy of the map, batch changes with modify to pay for it once.
+// Functions passed to the read calls run while slot 0 is held, so they must not use the lock-free containers themselves.
+template <typename T, typename U, typename Layout = SwissLayout, typename Hash = DefaultHash<T>>
+class ReadMostlyHashMap
+{
+	using Map = HashMap<T, U, Layout, Hash>;
+
+public:
+	ReadMostlyHashMap() : current_(new Map()) {}
+
+	~ReadMostlyHashMap()
+	{
+		delete current_.load(std::memory_order_relaxed);
+	}
+
+	// Readers could hold the current map, so it can not be copied or moved
+	ReadMostlyHashMap(const ReadMostlyHashMap& other) = delete;
+	ReadMostlyHashMap& operator=(const ReadMostlyHashMap& other) = delete;
+	ReadMostlyHashMap(ReadMostlyHashMap&& other) = delete;
+	ReadMostlyHashMap& operator=(ReadMostlyHashMap&& other) = delete;
+
+	// Returns a copy of the value, K is T or anything HashMap can look up transparently
+	template <typename K>
+	[[nodiscard]] std::optional<U> find(const K& key) const
+	{
+		return read([&](const Map& map)
+		{
+			const U* value = map.find(key);
+			return value == nullptr ? std::nullopt : std::optional<U>(*value);
+		});
+	}
+
+	// Calls function with the value without copying it, returns whether key was found
+	template <typename K, typename Function>
+	bool find(const K& key, Function function) const
+	{
+		return read([&](const Map& map)
+		{
+			const U* value = map.find(key);
+			if(value == nullptr) return false;
+			function(*value);
+			return true;
+		});
+	}
+
+	template <typename K>
+	[[nodiscard]] bool contains_key(const K& key) const
+	{
+		return read([&](const Map& map)
+		{
+			return map.contains_key(key);
+		});
+	}
+
+	// Calls function with the whole map as one consistent snapshot, later writes do not show up in it
+	template <typename Function>
+	auto read(Function function) const
+	{
+		struct Release
+		{
+			~Release()
+			{
+				HazardPointers::clear(0);
+			}
+		} release;
+		return function(*HazardPointers::protect(0, current_));
+	}
+
+	// Leaves an existing value alone, returns whether the key was inserted
+	bool insert(const T& key, U value)
+	{
+		if(contains_key(key)) return false;
+		return modify([&](Map& map)
+		{
+			return map.try_emplace(key, std::move(value));
+		});
+	}
+
+	// Overwrites an existing value
+	void insert_or_assign(const T& key, U value)
+	{
+		modify([&](Map& map)
+		{
+			map.insert(key, std::move(value));
+		});
+	}
+
+	// Returns whether key was in the map, only copies the map when it was
+	bool remove(const T& key)
+	{
+		if(!contains_key(key)) return false;
+		return modify([&](Map& map)
+		{
+			return map.remove(key);
+		});
+	}
+
+	// Applies function to a private copy of the map and publishes the result, readers see all of the changes or none.
+	// Returns what function returns, if function throws nothing is published
+	template <typename Function>
+	auto modify(Function function)
+	{
+		std::lock_guard<std::mutex> lock(write_mutex_);
+		std::unique_ptr<Map> next = std::make_unique<Map>(*current_.load(std::memory_order_relaxed));
+		if constexpr(std::is_void_v<decltype(function(*next))>)
+		{
+			function(*next);
+			publish(next.release());
+		}
+		else
+		{
+			auto result = function(*next);
+			publish(next.release());
+			return result;
+		}
+	}
+
+	void clear()
+	{
+		std::lock_guard<std::mutex> lock(write_mutex_);
+		publish(new Map());
+	}
+
+	[[nodiscard]] size_t size() const
+	{
+		return read([](const Map& map)
+		{
+			return map.size();
+		});
+	}
+
+	[[nodiscard]] bool empty() const
+	{
+		return size() == 0;
+	}
+
+private:
+	std::atomic<Map*> current_;
+	std::mutex write_mutex_;
+
+	void publish(Map* next)
+	{
+		Map* old = current_.exchange(next, std::memory_order_acq_rel);
+		HazardPointers::retire(old);
+	}
+};
+
+#endif // READ_MOSTLY_HASH_MAP_H
@@ -0,0 +1,385 @@
+#ifndef ROBIN_HOOD_TABLE_H
+#define ROBIN_HOOD_TABLE_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include "Hashing.h"
+
+enum
+{
+	ROBIN_HOOD_MINIMUM_CAPACITY = 16,
+	// Percentage of the slots that may be used before the table grows
+	ROBIN_HOOD_MAX_LOAD = 85,
+	// Distances are kept in a byte, longer ones are stored as this value and worked out from the hash where needed
+	ROBIN_HOOD_MAX_DISTANCE = 255
+};
+
+// Linear probing hash table with Robin Hood displacement, the second engine HashMap can run on.
+// Every slot stores how far its element is from its home slot, 0 meaning empty. An insert takes the slot of any element
+// that is closer to home than the one being inserted, which keeps all probe lengths close to the average.
+// A lookup can stop as soon as it passes an element closer to home than the key would be, so misses are short too,
+// and erase shifts the following elements one slot back instead of leaving tombstones.
+template <typename Key, typename Element, typename KeyOf, typename Hash, typename KeyEqual>
+class RobinHoodTable
+{
+	using Distance = uint8_t;
+
+public:
+	explicit RobinHoodTable(Hash hash = Hash(), KeyEqual equal = KeyEqual())
+		: distances_(empty_distances()), slots_(nullptr), capacity_(0), size_(0), hash_(std::move(hash)), equal_(std::move(equal)) {}
+
+	~RobinHoodTable()
+	{
+		destroy();
+	}
+
+	RobinHoodTable(const RobinHoodTable& other) : RobinHoodTable(other.hash_, other.equal_)
+	{
+		if(other.size_ == 0) return;
+
+		allocate(other.capacity_);
+		std::copy(other.distances_, other.distances_ + capacity_, distances_);
+		for(size_t i = 0; i < capacity_; i++)
+			if(distances_[i] != 0)
+				std::construct_at(&slots_[i], static_cast<const Element&>(other.slots_[i]));
+		size_ = other.size_;
+	}
+
+	RobinHoodTable& operator=(const RobinHoodTable& other)
+	{
+		if(this == &other) return *this;
+
+		RobinHoodTable copy(other);
+		swap(copy);
+		return *this;
+	}
+
+	RobinHoodTable(RobinHoodTable&& other) noexcept : RobinHoodTable(other.hash_, other.equal_)
+	{
+		swap(other);
+	}
+
+	RobinHoodTable& operator=(RobinHoodTable&& other) noexcept
+	{
+		if(this == &other) return *this;
+
+		destroy();
+		distances_ = empty_distances();
+		slots_ = nullptr;
+		capacity_ = 0;
+		size_ = 0;
+		swap(other);
+		return *this;
+	}
+
+	void swap(RobinHoodTable& other) noexcept
+	{
+		std::swap(distances_, other.distances_);
+		std::swap(slots_, other.slots_);
+		std::swap(capacity_, other.capacity_);
+		std::swap(size_, other.size_);
+		std::swap(hash_, other.hash_);
+		std::swap(equal_, other.equal_);
+	}
+
+	// K is Key, or any type Hash and KeyEqual accept next to Key when they are transparent
+	template <typename K>
+	[[nodiscard]] Element* find(const K& key)
+	{
+		size_t index;
+		size_t distance;
+		return probe(key, table_hash(hash_, key), index, distance) ? &slots_[index] : nullptr;
+	}
+
+	template <typename K>
+	[[nodiscard]] const Element* find(const K& key) const
+	{
+		return const_cast<RobinHoodTable*>(this)->find(key);
+	}
+
+	// Hash of key the way the table uses it, for prefetch and find_hashed
+	template <typename K>
+	[[nodiscard]] size_t hash_of(const K& key) const
+	{
+		return table_hash(hash_, key);
+	}
+
+	// Starts loading the home slot of hash, so that a later find_hashed does not wait on memory
+	void prefetch(const size_t hash) const noexcept
+	{
+		const size_t index = hash & mask();
+		prefetch_address(distances_ + index);
+		prefetch_address(slots_ + index);
+	}
+
+	template <typename K>
+	[[nodiscard]] Element* find_hashed(const K& key, const size_t hash)
+	{
+		size_t index;
+		size_t distance;
+		return probe(key, hash, index, distance) ? &slots_[index] : nullptr;
+	}
+
+	template <typename K>
+	[[nodiscard]] const Element* find_hashed(const K& key, const size_t hash) const
+	{
+		return const_cast<RobinHoodTable*>(this)->find_hashed(key, hash);
+	}
+
+	// Constructs an element from args when key is not in the table yet, returns the element and whether it was inserted
+	template <typename... Args>
+	std::pair<Element*, bool> try_emplace(const Key& key, Args&&... args)
+	{
+		const size_t hash = table_hash(hash_, key);
+		size_t index;
+		size_t distance;
+		if(probe(key, hash, index, distance)) return { &slots_[index], false };
+
+		if((size_ + 1) * 100 > capacity_ * ROBIN_HOOD_MAX_LOAD)
+		{
+			rehash(capacity_ == 0 ? static_cast<size_t>(ROBIN_HOOD_MINIMUM_CAPACITY) : capacity_ * 2);
+			probe(key, hash, index, distance);
+		}
+
+		shift_run(index);
+		try
+		{
+			std::construct_at(&slots_[index], std::forward<Args>(args)...);
+		}
+		catch(...)
+		{
+			// The run already moved out of the way, pull it back so the table is as it was
+			close_gap(index);
+			throw;
+		}
+		distances_[index] = saturate(distance);
+		size_++;
+		return { &slots_[index], true };
+	}
+
+	template <typename K>
+	bool erase(const K& key)
+	{
+		size_t index;
+		size_t distance;
+		if(!probe(key, table_hash(hash_, key), index, distance)) return false;
+
+		std::destroy_at(&slots_[index]);
+		size_--;
+		close_gap(index);
+		return true;
+	}
+
+	void clear() noexcept
+	{
+		for(size_t i = 0; i < capacity_; i++)
+		{
+			if(distances_[i] != 0)
+				std::destroy_at(&slots_[i]);
+			distances_[i] = 0;
+		}
+		size_ = 0;
+	}
+
+	// Makes room for count elements so that inserting them does not grow the table
+	void reserve(const size_t count)
+	{
+		if(count * 100 <= capacity_ * ROBIN_HOOD_MAX_LOAD) return;
+
+		size_t capacity = capacity_ == 0 ? static_cast<size_t>(ROBIN_HOOD_MINIMUM_CAPACITY) : capacity_;
+		while(count * 100 > capacity * ROBIN_HOOD_MAX_LOAD)
+			capacity *= 2;
+		rehash(capacity);
+	}
+
+	template <typename Function>
+	void for_each(Function function)
+	{
+		for(size_t i = 0; i < capacity_; i++)
+			if(distances_[i] != 0)
+				function(slots_[i]);
+	}
+
+	template <typename Function>
+	void for_each(Function function) const
+	{
+		for(size_t i = 0; i < capacity_; i++)
+			if(distances_[i] != 0)
+				function(static_cast<const Element&>(slots_[i]));
+	}
+
+	[[nodiscard]] size_t size() const noexcept
+	{
+		return size_;
+	}
+
+	[[nodiscard]] size_t capacity() const noexcept
+	{
+		return capacity_;
+	}
+
+	// Probe length of an element is its distance, the number of slots a lookup of it looks at
+	[[nodiscard]] ProbeStats probe_stats() const
+	{
+		ProbeStats stats;
+		stats.capacity = capacity_;
+		for(size_t i = 0; i < capacity_; i++)
+			if(distances_[i] != 0)
+				stats.record(distance_at(i));
+		return stats;
+	}
+
+private:
+	// Distance of an element in its home slot is 1, so that 0 can mean empty
+	Distance* distances_;
+	Element* slots_;
+	size_t capacity_;
+	size_t size_;
+	Hash hash_;
+	KeyEqual equal_;
+
+	// Shared by all tables without storage, so a lookup in an empty table needs no special case
+	static Distance* empty_distances() noexcept
+	{
+		static Distance distances[1] = { 0 };
+		return distances;
+	}
+
+	[[nodiscard]] size_t mask() const noexcept
+	{
+		return capacity_ == 0 ? 0 : capacity_ - 1;
+	}
+
+	// Distance as it is stored, a slot holding ROBIN_HOOD_MAX_DISTANCE is at least that far from home
+	static Distance saturate(const size_t distance) noexcept
+	{
+		return static_cast<Distance>(distance < static_cast<size_t>(ROBIN_HOOD_MAX_DISTANCE) ? distance : static_cast<size_t>(ROBIN_HOOD_MAX_DISTANCE));
+	}
+
+	// Exact distance of the element at index, only saturated slots need their hash for it
+	[[nodiscard]] size_t distance_at(const size_t index) const
+	{
+		if(distances_[index] != ROBIN_HOOD_MAX_DISTANCE) return distances_[index];
+		return ((index - table_hash(hash_, KeyOf::get(slots_[index]))) & mask()) + 1;
+	}
+
+	// Walks the probe sequence of hash until key or the first element closer to home than key would be.
+	// Returns whether key was found, index is then its slot, or else the slot key belongs in, with the distance it would have there.
+	// Past ROBIN_HOOD_MAX_DISTANCE the distances of saturated slots come from their hashes, which only keys sharing their hashes ever get to
+	template <typename K>
+	bool probe(const K& key, const size_t hash, size_t& index, size_t& distance) const
+	{
+		index = hash & mask();
+		for(distance = 1; distances_[index] >= saturate(distance); distance++)
+		{
+			if(distances_[index] == saturate(distance))
+			{
+				const size_t exact = distance_at(index);
+				if(exact < distance) return false;
+				if(exact == distance && equal_(KeyOf::get(slots_[index]), key)) return true;
+			}
+			index = (index + 1) & mask();
+		}
+		return false;
+	}
+
+	// Moves the run of elements starting at index one slot further, which is all a Robin Hood insert amounts to
+	void shift_run(const size_t index)
+	{
+		size_t empty = index;
+		while(distances_[empty] != 0)
+			empty = (empty + 1) & mask();
+
+		while(empty != index)
+		{
+			const size_t previous = (empty - 1) & mask();
+			std::construct_at(&slots_[empty], std::move(slots_[previous]));
+			std::destroy_at(&slots_[previous]);
+			distances_[empty] = saturate(distances_[previous] + 1u);
+			empty = previous;
+		}
+	}
+
+	// Fills the destroyed slot at index by pulling every following element that is not at home one slot closer to it
+	void close_gap(size_t index)
+	{
+		size_t next = (index + 1) & mask();
+		while(distances_[next] > 1)
+		{
+			std::construct_at(&slots_[index], std::move(slots_[next]));
+			std::destroy_at(&slots_[next]);
+			distances_[index] = saturate(distance_at(next) - 1);
+			index = next;
+			next = (next + 1) & mask();
+		}
+		distances_[index] = 0;
+	}
+
+	// Moves every element into a fresh table of the given capacity in one pass.
+	// Old slots are walked starting from an empty one, so runs that wrap around the end come out whole and in order of their homes.
+	// That way every element lands behind the ones that were in front of it and no run ever has to be shifted,
+	// and a bigger table never needs longer distances than the old one.
+	void rehash(const size_t capacity)
+	{
+		Distance* oldDistances = distances_;
+		Element* oldSlots = slots_;
+		const size_t oldCapacity = capacity_;
+
+		size_t start = 0;
+		while(start < oldCapacity && oldDistances[start] != 0)
+			start++;
+
+		allocate(capacity);
+		for(size_t n = 0; n < oldCapacity; n++)
+		{
+			const size_t i = (start + n) & (oldCapacity - 1);
+			if(oldDistances[i] == 0) continue;
+
+			size_t index = table_hash(hash_, KeyOf::get(oldSlots[i])) & mask();
+			size_t distance = 1;
+			while(distances_[index] != 0)
+			{
+				index = (index + 1) & mask();
+				distance++;
+			}
+			std::construct_at(&slots_[index], std::move(oldSlots[i]));
+			std::destroy_at(&oldSlots[i]);
+			distances_[index] = saturate(distance);
+		}
+		deallocate(oldDistances, oldSlots, oldCapacity);
+	}
+
+	void allocate(const size_t capacity)
+	{
+		distances_ = new Distance[capacity]();
+		slots_ = std::allocator<Element>().allocate(capacity);
+		capacity_ = capacity;
+	}
+
+	static void deallocate(Distance* distances, Element* slots, const size_t capacity) noexcept
+	{
+		if(capacity == 0) return;
+		delete[] distances;
+		std::allocator<Element>().deallocate(slots, capacity);
+	}
+
+	void destroy() noexcept
+	{
+		for(size_t i = 0; i < capacity_; i++)
+			if(distances_[i] != 0)
+				std::destroy_at(&slots_[i]);
+		deallocate(distances_, slots_, capacity_);
+	}
+};
+
+// Layout policy for HashMap
+struct RobinHoodLayout
+{
+	template <typename Key, typename Element, typename KeyOf, typename Hash, typename KeyEqual>
+	using Table = RobinHoodTable<Key, Element, KeyOf, Hash, KeyEqual>;
+};
+
+#endif // ROBIN_HOOD_TABLE_H
@@ -4,13 +4,15 @@
 #include <vector>
 #include <array>
 #include <stdexcept>
+#include <functional>
 #include <string>
 #include "TypeTraitsCheck.h"
+#include <memory>
+#include <utility>
 
 template <typename T>
 class SLinkedList
 {
-	static_assert(std::is_copy_constructible_v<T>, "Attempted to make a SLinkedList with a type that does not implement a copy constructor");
 	static_assert(!std::is_pointer_v<T>, "Attempted to make a SLinkedList with a raw pointer type");
 	template <typename Y>
 	struct Node
@@ -18,13 +20,8 @@ class SLinkedList
 		std::unique_ptr<Y> data;
 		Node* next;
 
-		explicit Node(Y data) : data(std::make_unique<Y>(data)), next(nullptr) {}
-
-		explicit Node(Y** data) : data(std::make_unique<Y>(std::move(data))), next(nullptr) {}
-
-		explicit Node(Y data, Node* next) : data(std::make_unique<Y>(data)), next(next) {}
-
-		explicit Node(Y** data, Node* next) : data(std::make_unique<Y>(std::move(data))), next(next) {}
+		template <typename... Args>
+		explicit Node(Args&&... args) : data(std::make_unique<Y>(std::forward<Args>(args)...)), next(nullptr) {}
 	};
 
 public:
@@ -71,6 +68,98 @@ public:
 		return Iterator(nullptr);
 	}
 
+	// A position in the list that supports O(1) insertion and removal.
+	// Any structural change made through the list itself (or another cursor) invalidates the cursor.
+	class Cursor
+	{
+		friend class SLinkedList;
+	public:
+		explicit Cursor(SLinkedList* list, Node<T>* prev, Node<T>* node, const size_t index) : list_(list), prev_(prev), node_(node), index_(index) {}
+
+		[[nodiscard]] bool at_end() const noexcept
+		{
+			return node_ == nullptr;
+		}
+
+		[[nodiscard]] size_t index() const noexcept
+		{
+			return index_;
+		}
+
+		T& operator*() const
+		{
+			if(node_ == nullptr) throw std::out_of_range("Cursor out of bounds");
+			return *(node_->data);
+		}
+
+		T* operator->() const
+		{
+			if(node_ == nullptr) throw std::out_of_range("Cursor out of bounds");
+			return node_->data.get();
+		}
+
+		Cursor& operator++()
+		{
+			if(node_ == nullptr) throw std::out_of_range("Cursor out of bounds");
+			prev_ = node_;
+			node_ = node_->next;
+			index_++;
+			return *this;
+		}
+
+		// Inserts before the current element, the cursor keeps pointing at the same element
+		void insert(const T& data)
+		{
+			insert_node(new Node<T>(data));
+		}
+
+		void insert(T&& data)
+		{
+			insert_node(new Node<T>(std::move(data)));
+		}
+
+		// Removes the current element, the cursor moves on to the next element
+		void erase()
+		{
+			if(node_ == nullptr) throw std::out_of_range("Cursor out of bounds");
+			list_->invalidate_cache_from(index_);
+			delete list_->unlink_after(prev_);
+			node_ = prev_ == nullptr ? list_->head_ : prev_->next;
+		}
+
+	private:
+		SLinkedList* list_;
+		Node<T>* prev_;
+		Node<T>* node_;
+		size_t index_;
+
+		void insert_node(Node<T>* newNode)
+		{
+			list_->invalidate_cache_from(index_);
+			list_->link_after(prev_, newNode);
+			prev_ = newNode;
+			index_++;
+		}
+	};
+
+	Cursor cursor()
+	{
+		return Cursor(this, nullptr, head_, 0);
+	}
+
+	// index may be equal to size(), which gives a cursor past the last element
+	Cursor cursor_at(const size_t index)
+	{
+		if(index == 0) return cursor();
+		if(index <= count_)
+		{
+			Node<T>* prev = unsafe_get_pointer_at(index - 1);
+			return Cursor(this, prev, prev->next, index);
+		}
+
+		throw std::out_of_range("Index out of bounds\nindex: " + std::to_string(index) + "\nsize: " + std::to_string(count_));
+	}
+
 	SLinkedList() : count_(0), head_(nullptr), tail_(nullptr)  {}
 
 	SLinkedList(T data[], const size_t size) : count_(size)
@@ -87,8 +176,8 @@ public:
 
 	explicit SLinkedList(std::vector<T> data) : count_(data.size())
 	{
-		const T* p = data.begin();
-		head_ = new Node<T>(p[0]);
+		T* p = data.data();
+		head_ = new Node<T>(std::move(p[0]));
 		Node<T>* current = head_;
 		for(size_t i = 1; i < count_; i++)
 		{
@@ -101,12 +190,12 @@ public:
 	template <size_t N>
 	explicit SLinkedList(std::array<T, N> data) : count_(N)
 	{
-		const T* p = data.begin();
-		head_ = new Node<T>(p[0]);
+		T* p = data.data();
+		head_ = new Node<T>(std::move(p[0]));
 		Node<T>* current = head_;
 		for(size_t i = 1; i < N; ++i)
 		{
-			current->next = new Node<T>(std::move(p[0]));
+			current->next = new Node<T>(std::move(p[i]));
 			current = current->next;
 		}
 		tail_ = current;
@@ -136,27 +225,19 @@ public:
 		}
 	}
 
-	SLinkedList(const SLinkedList& other) : count_(0), head_(nullptr), tail_(nullptr)
+	SLinkedList(const SLinkedList& other) requires std::is_copy_constructible_v<T> : count_(0), head_(nullptr), tail_(nullptr)
 	{
-		Node<T>* currentOther = new Node<T>(*(other.head_->data));
-		while(currentOther != nullptr)
-		{
-			append(*(currentOther->data));
-			currentOther = currentOther->next;
-		}
+		for(Node<T>* current = other.head_; current != nullptr; current = current->next)
+			append(*(current->data));
 	}
 
-	SLinkedList& operator=(const SLinkedList& other)
+	SLinkedList& operator=(const SLinkedList& other) requires std::is_copy_constructible_v<T>
 	{
 		if(this == &other) return *this;
 
 		clear();
-		Node<T>* current = new Node<T>(*(other.head_->data));
-		while(current != nullptr)
-		{
+		for(Node<T>* current = other.head_; current != nullptr; current = current->next)
 			append(*(current->data));
-			current = current->next;
-		}
 
 		return *this;
 	}
@@ -169,6 +250,7 @@ public:
 		other.head_ = nullptr;
 		other.tail_ = nullptr;
 		other.count_ = 0;
+		other.cache_node_ = nullptr;
 	}
 
 	SLinkedList& operator=(SLinkedList&& other) noexcept
@@ -182,10 +264,26 @@ public:
 		other.head_ = nullptr;
 		other.tail_ = nullptr;
 		other.count_ = 0;
+		other.cache_node_ = nullptr;
 
 		return *this;
 	}
 
+	// Only exchanges the head and tail pointers, no node is touched
+	void swap(SLinkedList& other) noexcept
+	{
+		std::swap(head_, other.head_);
+		std::swap(tail_, other.tail_);
+		std::swap(count_, other.count_);
+		std::swap(cache_node_, other.cache_node_);
+		std::swap(cache_index_, other.cache_index_);
+	}
+
+	friend void swap(SLinkedList& a, SLinkedList& b) noexcept
+	{
+		a.swap(b);
+	}
+
 	template <typename U = T, std::enable_if_t<is_printable<U>::value, int> = 0>
 	friend std::ostream& operator<<(std::ostream& os, const SLinkedList& list)
 	{
@@ -272,6 +370,7 @@ public:
 
 	void prepend(const T& data) noexcept
 	{
+		invalidate_cache_from(0);
 		Node<T>* newNode = new Node<T>(data);
 		if(head_ == nullptr)
 		{
@@ -287,6 +386,7 @@ public:
 
 	void prepend(T&& data) noexcept
 	{
+		invalidate_cache_from(0);
 		Node<T>* newNode = new Node<T>(std::move(data));
 		if(head_ == nullptr)
 		{
@@ -301,7 +401,30 @@ public:
 		count_++;
 	}
 
-	[[nodiscard]] T front() const
+	template <typename... Args>
+	T& emplace_back(Args&&... args)
+	{
+		Node<T>* newNode = new Node<T>(std::forward<Args>(args)...);
+		link_after(tail_, newNode);
+		return *(newNode->data);
+	}
+
+	template <typename... Args>
+	T& emplace_front(Args&&... args)
+	{
+		invalidate_cache_from(0);
+		Node<T>* newNode = new Node<T>(std::forward<Args>(args)...);
+		link_after(nullptr, newNode);
+		return *(newNode->data);
+	}
+
+	[[nodiscard]] T& front()
+	{
+		if(head_ != nullptr) return *(head_->data);
+		throw std::out_of_range("List is empty");
+	}
+
+	[[nodiscard]] const T& front() const
 	{
 		if(head_ != nullptr) return *(head_->data);
 		throw std::out_of_range("List is empty");
@@ -311,8 +434,9 @@ public:
 	{
 		if(head_ != nullptr)
 		{
+			invalidate_cache_from(0);
 			const Node<T>* temp = head_;
-			T res = *(head_->data);
+			T res = std::move(*(head_->data));
 			if(head_ == tail_)
 			{
 				head_ = nullptr;
@@ -328,7 +452,65 @@ public:
 		throw std::out_of_range("List is empty");
 	}
 
-	[[nodiscard]] T back() const
+	// Links copies of first..last in front of the list in one go, the last element of the range ends up at the front
+	template <typename InputIt>
+	size_t prepend_range(InputIt first, InputIt last)
+	{
+		if(first == last) return 0;
+
+		Node<T>* chainTail = new Node<T>(*first);
+		Node<T>* chainHead = chainTail;
+		size_t count = 1;
+		try
+		{
+			for(++first; first != last; ++first, count++)
+			{
+				Node<T>* node = new Node<T>(*first);
+				node->next = chainHead;
+				chainHead = node;
+			}
+		}
+		catch(...)
+		{
+			delete_chain(chainHead);
+			throw;
+		}
+
+		invalidate_cache_from(0);
+		link_range_after(nullptr, chainHead, chainTail, count);
+		return count;
+	}
+
+	// Moves up to n elements from the front into out and unlinks them all at once, returns how many were moved
+	template <typename OutputIt>
+	size_t pop_front_n(OutputIt out, const size_t n)
+	{
+		const size_t count = n < count_ ? n : count_;
+		if(count == 0) return 0;
+
+		invalidate_cache_from(0);
+		Node<T>* current = head_;
+		for(size_t i = 0; i < count; i++, ++out)
+		{
+			*out = std::move(*(current->data));
+			Node<T>* next = current->next;
+			delete current;
+			current = next;
+		}
+		head_ = current;
+		if(head_ == nullptr)
+			tail_ = nullptr;
+		count_ -= count;
+		return count;
+	}
+
+	[[nodiscard]] T& back()
+	{
+		if(tail_ != nullptr) return *(tail_->data);
+		throw std::out_of_range("List is empty");
+	}
+
+	[[nodiscard]] const T& back() const
 	{
 		if(tail_ != nullptr) return *(tail_->data);
 		throw std::out_of_range("List is empty");
@@ -338,8 +520,9 @@ public:
 	{
 		if(tail_ != nullptr)
 		{
+			invalidate_cache_from(count_ - 1);
 			const Node<T>* temp = tail_;
-			T res = *(tail_->data);
+			T res = std::move(*(tail_->data));
 			if(head_ == tail_)
 			{
 				head_ = nullptr;
@@ -363,6 +546,7 @@ public:
 	{
 		if(index < count_)
 		{
+			invalidate_cache_from(index);
 			Node<T>* newNode = new Node<T>(data);
 			if(index == 0)
 			{
@@ -385,6 +569,7 @@ public:
 	{
 		if(index < count_)
 		{
+			invalidate_cache_from(index);
 			Node<T>* newNode = new Node<T>(std::move(data));
 			if(index == 0)
 			{
@@ -407,6 +592,7 @@ public:
 	{
 		if(index < count_)
 		{
+			invalidate_cache_from(index);
 			if(index == 0)
 			{
 				if(head_ == tail_)
@@ -441,18 +627,169 @@ public:
 			throw std::out_of_range("Index out of bounds\nindex: " + std::to_string(index) + "\nsize: " + std::to_string(count_));
 	}
 
-	void clear() noexcept
+	// Moves every element of other in front of pos without copying, other is left empty
+	void splice(const Cursor& pos, SLinkedList& other)
+	{
+		if(pos.list_ != this) throw std::invalid_argument("Cursor does not belong to this list");
+		if(&other == this || other.head_ == nullptr) return;
+
+		invalidate_cache_from(pos.index_);
+		link_range_after(pos.prev_, other.head_, other.tail_, other.count_);
+		other.head_ = nullptr;
+		other.tail_ = nullptr;
+		other.count_ = 0;
+		other.cache_node_ = nullptr;
+	}
+
+	// Moves the elements of other in [first, last) in front of pos without copying
+	void splice(const Cursor& pos, SLinkedList& other, const Cursor& first, const Cursor& last)
+	{
+		if(pos.list_ != this) throw std::invalid_argument("Cursor does not belong to this list");
+		if(first.list_ != &other || last.list_ != &other) throw std::invalid_argument("Range does not belong to the other list");
+		if(first.index_ > last.index_) throw std::invalid_argument("Range start lies after range end");
+		const size_t moved = last.index_ - first.index_;
+		if(moved == 0) return;
+		if(&other == this)
+		{
+			if(pos.index_ == first.index_ || pos.index_ == last.index_) return;
+			if(pos.index_ > first.index_ && pos.index_ < last.index_) throw std::invalid_argument("Cannot splice a range into itself");
+		}
+
+		other.invalidate_cache_from(first.index_);
+		invalidate_cache_from(pos.index_);
+		Node<T>* lastNode = last.prev_;
+		Node<T>* firstNode = other.unlink_range_after(first.prev_, lastNode, moved);
+		link_range_after(pos.prev_, firstNode, lastNode, moved);
+	}
+
+	// Keeps the elements before index and returns the rest as a new list without copying
+	SLinkedList split_at(const size_t index)
+	{
+		if(index > count_)
+			throw std::out_of_range("Index out of bounds\nindex: " + std::to_string(index) + "\nsize: " + std::to_string(count_));
+
+		SLinkedList res;
+		if(index == count_) return res;
+
+		Node<T>* prev = index == 0 ? nullptr : unsafe_get_pointer_at(index - 1);
+		invalidate_cache_from(index);
+		res.head_ = prev == nullptr ? head_ : prev->next;
+		res.tail_ = tail_;
+		res.count_ = count_ - index;
+		if(prev == nullptr)
+			head_ = nullptr;
+		else
+			prev->next = nullptr;
+		tail_ = prev;
+		count_ = index;
+		return res;
+	}
+
+	// Appends every element of other without copying
+	void concat(SLinkedList&& other)
+	{
+		if(&other == this || other.head_ == nullptr) return;
+
+		link_range_after(tail_, other.head_, other.tail_, other.count_);
+		other.head_ = nullptr;
+		other.tail_ = nullptr;
+		other.count_ = 0;
+		other.cache_node_ = nullptr;
+	}
+
+	// Stable bottom-up merge sort, relinks the nodes instead of moving elements and needs no extra memory
+	template <typename Compare = std::less<T>>
+	void sort(Compare comp = Compare())
 	{
+		if(count_ < 2) return;
+
+		cache_node_ = nullptr;
+		for(size_t width = 1; width < count_; width *= 2)
+		{
+			Node<T>* rest = head_;
+			Node<T>* sortedTail = nullptr;
+			while(rest != nullptr)
+			{
+				Node<T>* left = rest;
+				Node<T>* right = cut_chain(left, width);
+				rest = cut_chain(right, width);
+
+				Node<T>* mergedTail;
+				Node<T>* merged = merge_chains(left, right, comp, mergedTail);
+				if(sortedTail == nullptr)
+					head_ = merged;
+				else
+					sortedTail->next = merged;
+				sortedTail = mergedTail;
+			}
+			tail_ = sortedTail;
+		}
+	}
+
+	// Merges the sorted other into this sorted list without copying, other is left empty
+	template <typename Compare = std::less<T>>
+	void merge(SLinkedList& other, Compare comp = Compare())
+	{
+		if(&other == this || other.head_ == nullptr) return;
+
+		cache_node_ = nullptr;
+		head_ = merge_chains(head_, other.head_, comp, tail_);
+		count_ += other.count_;
+		other.head_ = nullptr;
+		other.tail_ = nullptr;
+		other.count_ = 0;
+		other.cache_node_ = nullptr;
+	}
+
+	// Removes consecutive equal elements, returns the amount of elements removed
+	template <typename U = T, std::enable_if_t<is_equatable<U>::value, int> = 0>
+	size_t unique() noexcept
+	{
+		if(count_ < 2) return 0;
+
+		cache_node_ = nullptr;
+		size_t removed = 0;
 		Node<T>* current = head_;
+		while(current->next != nullptr)
+		{
+			Node<T>* next = current->next;
+			if(*(next->data) == *(current->data))
+			{
+				current->next = next->next;
+				delete next;
+				removed++;
+			}
+			else
+				current = next;
+		}
+		tail_ = current;
+		count_ -= removed;
+		return removed;
+	}
+
+	void reverse() noexcept
+	{
+		cache_node_ = nullptr;
+		Node<T>* current = head_;
+		Node<T>* prev = nullptr;
+		tail_ = head_;
 		while(current != nullptr)
 		{
 			Node<T>* next = current->next;
-			delete current;
+			current->next = prev;
+			prev = current;
 			current = next;
 		}
+		head_ = prev;
+	}
+
+	void clear() noexcept
+	{
+		delete_chain(head_);
 		head_ = nullptr;
 		tail_ = nullptr;
 		count_ = 0;
+		cache_node_ = nullptr;
 	}
 
 	[[nodiscard]] size_t size() const noexcept
@@ -469,18 +806,145 @@ private:
 	size_t count_;
 	Node<T>* head_;
 	Node<T>* tail_;
+	// Last node looked up by index, lets sequential index access resume instead of restarting at head_
+	// Because of this, even const lookups modify the list and are not safe to call concurrently
+	mutable Node<T>* cache_node_ = nullptr;
+	mutable size_t cache_index_ = 0;
 
 	[[nodiscard]] Node<T>* unsafe_get_pointer_at(const size_t index) const
 	{
 		Node<T>* res = head_;
 		size_t pos = 0;
+		if(index == count_ - 1)
+		{
+			res = tail_;
+			pos = index;
+		}
+		else if(cache_node_ != nullptr && cache_index_ <= index)
+		{
+			res = cache_node_;
+			pos = cache_index_;
+		}
+
 		while(pos != index)
 		{
 			res = res->next;
 			pos++;
 		}
+		cache_node_ = res;
+		cache_index_ = index;
 		return res;
 	}
+
+	// Drops the cached node when its index is affected by a change at index
+	void invalidate_cache_from(const size_t index) noexcept
+	{
+		if(cache_index_ >= index)
+			cache_node_ = nullptr;
+	}
+
+	// Deletes node and every node after it
+	static void delete_chain(Node<T>* node) noexcept
+	{
+		while(node != nullptr)
+		{
+			Node<T>* next = node->next;
+			delete node;
+			node = next;
+		}
+	}
+
+	// Links node after prev, or at the front when prev is nullptr
+	void link_after(Node<T>* prev, Node<T>* node) noexcept
+	{
+		link_range_after(prev, node, node, 1);
+	}
+
+	// Unlinks the node after prev, or the front when prev is nullptr
+	Node<T>* unlink_after(Node<T>* prev) noexcept
+	{
+		return unlink_range_after(prev, prev == nullptr ? head_ : prev->next, 1);
+	}
+
+	// Links the chain first..last of length count after prev, or at the front when prev is nullptr
+	void link_range_after(Node<T>* prev, Node<T>* first, Node<T>* last, const size_t count) noexcept
+	{
+		if(prev == nullptr)
+		{
+			last->next = head_;
+			head_ = first;
+		}
+		else
+		{
+			last->next = prev->next;
+			prev->next = first;
+		}
+		if(last->next == nullptr)
+			tail_ = last;
+		count_ += count;
+	}
+
+	// Unlinks the chain of length count that follows prev and ends at last, returns its first node
+	Node<T>* unlink_range_after(Node<T>* prev, Node<T>* last, const size_t count) noexcept
+	{
+		Node<T>* first = prev == nullptr ? head_ : prev->next;
+		if(prev == nullptr)
+			head_ = last->next;
+		else
+			prev->next = last->next;
+		if(tail_ == last)
+			tail_ = prev;
+		last->next = nullptr;
+		count_ -= count;
+		return first;
+	}
+
+	// Cuts the chain starting at node after n nodes, returns the remainder
+	static Node<T>* cut_chain(Node<T>* node, size_t n) noexcept
+	{
+		while(node != nullptr && n > 1)
+		{
+			node = node->next;
+			n--;
+		}
+		if(node == nullptr) return nullptr;
+
+		Node<T>* rest = node->next;
+		node->next = nullptr;
+		return rest;
+	}
+
+	// Merges two sorted chains through their next pointers, takes from a on ties to stay stable
+	template <typename Compare>
+	static Node<T>* merge_chains(Node<T>* a, Node<T>* b, Compare& comp, Node<T>*& tail)
+	{
+		Node<T>* head = nullptr;
+		Node<T>** link = &head;
+		tail = nullptr;
+		while(a != nullptr && b != nullptr)
+		{
+			if(comp(*(b->data), *(a->data)))
+			{
+				tail = b;
+				b = b->next;
+			}
+			else
+			{
+				tail = a;
+				a = a->next;
+			}
+			*link = tail;
+			link = &(tail->next);
+		}
+
+		*link = a != nullptr ? a : b;
+		while(*link != nullptr)
+		{
+			tail = *link;
+			link = &(tail->next);
+		}
+		return head;
+	}
 };
 
 #endif // LINKEDLIST_H
\ No newline at end of file
@@ -0,0 +1,157 @@
+#ifndef SPSC_QUEUE_H
+#define SPSC_QUEUE_H
+
+#include <atomic>
+#include <memory>
+#include <type_traits>
+#include "CacheLine.h"
+
+// Bounded wait-free ring queue for exactly one producer thread and one consumer thread.
+// push/emplace/push_n may only be called from the producer, pop/peek/pop_n only from the consumer.
+// Both sides keep a private copy of the other side's index and only reload it when the copy says the queue is full or empty,
+// so in steady state neither side touches the other's cache line.
+template <typename T, size_t Capacity>
+class SpscQueue
+{
+	static_assert(!std::is_pointer_v<T>, "Attempted to make a SpscQueue with a raw pointer type");
+	static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0, "SpscQueue capacity must be a power of two");
+
+public:
+	SpscQueue() : tail_(0), cached_head_(0), head_(0), cached_tail_(0), slots_(std::allocator<T>().allocate(Capacity)) {}
+
+	~SpscQueue()
+	{
+		const size_t tail = tail_.load(std::memory_order_relaxed);
+		for(size_t i = head_.load(std::memory_order_relaxed); i != tail; i++)
+			std::destroy_at(&slots_[i & MASK]);
+		std::allocator<T>().deallocate(slots_, Capacity);
+	}
+
+	// Both threads hold on to this queue, so it can not be copied or moved
+	SpscQueue(const SpscQueue& other) = delete;
+	SpscQueue& operator=(const SpscQueue& other) = delete;
+	SpscQueue(SpscQueue&& other) = delete;
+	SpscQueue& operator=(SpscQueue&& other) = delete;
+
+	// Returns false when the queue is full
+	bool push(const T& data)
+	{
+		return emplace(data);
+	}
+
+	bool push(T&& data)
+	{
+		return emplace(std::move(data));
+	}
+
+	template <typename... Args>
+	bool emplace(Args&&... args)
+	{
+		const size_t tail = tail_.load(std::memory_order_relaxed);
+		if(tail - cached_head_ == Capacity)
+		{
+			cached_head_ = head_.load(std::memory_order_acquire);
+			if(tail - cached_head_ == Capacity) return false;
+		}
+
+		std::construct_at(&slots_[tail & MASK], std::forward<Args>(args)...);
+		tail_.store(tail + 1, std::memory_order_release);
+		return true;
+	}
+
+	// Copies up to count elements starting at first and publishes them all at once, returns how many fit
+	template <typename InputIt>
+	size_t push_n(InputIt first, const size_t count)
+	{
+		const size_t tail = tail_.load(std::memory_order_relaxed);
+		if(Capacity - (tail - cached_head_) < count)
+			cached_head_ = head_.load(std::memory_order_acquire);
+		const size_t free = Capacity - (tail - cached_head_);
+		const size_t pushed = count < free ? count : free;
+
+		for(size_t i = 0; i < pushed; i++, ++first)
+			std::construct_at(&slots_[(tail + i) & MASK], *first);
+		tail_.store(tail + pushed, std::memory_order_release);
+		return pushed;
+	}
+
+	// Moves the front element into out, returns false when the queue is empty
+	bool pop(T& out)
+	{
+		const size_t head = head_.load(std::memory_order_relaxed);
+		if(head == cached_tail_)
+		{
+			cached_tail_ = tail_.load(std::memory_order_acquire);
+			if(head == cached_tail_) return false;
+		}
+
+		T& slot = slots_[head & MASK];
+		out = std::move(slot);
+		std::destroy_at(&slot);
+		head_.store(head + 1, std::memory_order_release);
+		return true;
+	}
+
+	// Moves up to count elements into out and releases their slots all at once, returns how many were popped
+	template <typename OutputIt>
+	size_t pop_n(OutputIt out, const size_t count)
+	{
+		const size_t head = head_.load(std::memory_order_relaxed);
+		if(cached_tail_ - head < count)
+			cached_tail_ = tail_.load(std::memory_order_acquire);
+		const size_t available = cached_tail_ - head;
+		const size_t popped = count < available ? count : available;
+
+		for(size_t i = 0; i < popped; i++, ++out)
+		{
+			T& slot = slots_[(head + i) & MASK];
+			*out = std::move(slot);
+			std::destroy_at(&slot);
+		}
+		head_.store(head + popped, std::memory_order_release);
+		return popped;
+	}
+
+	// Returns the front element without removing it, or nullptr when the queue is empty
+	[[nodiscard]] T* peek()
+	{
+		const size_t head = head_.load(std::memory_order_relaxed);
+		if(head == cached_tail_)
+		{
+			cached_tail_ = tail_.load(std::memory_order_acquire);
+			if(head == cached_tail_) return nullptr;
+		}
+		return &slots_[head & MASK];
+	}
+
+	// Only a snapshot when called while the other side is active
+	[[nodiscard]] size_t size() const noexcept
+	{
+		const size_t head = head_.load(std::memory_order_acquire);
+		return tail_.load(std::memory_order_acquire) - head;
+	}
+
+	[[nodiscard]] bool empty() const noexcept
+	{
+		return size() == 0;
+	}
+
+	[[nodiscard]] static constexpr size_t capacity() noexcept
+	{
+		return Capacity;
+	}
+
+private:
+	static constexpr size_t MASK = Capacity - 1;
+
+	// Producer side
+	alignas(CACHE_LINE_SIZE) std::atomic<size_t> tail_;
+	size_t cached_head_;
+	// Consumer side
+	alignas(CACHE_LINE_SIZE) std::atomic<size_t> head_;
+	size_t cached_tail_;
+	// Shared, but never written after construction
+	alignas(CACHE_LINE_SIZE) T* slots_;
+};
+
+#endif // SPSC_QUEUE_H
@@ -4,62 +4,67 @@
 #include <vector>
 #include <array>
 #include <stdexcept>
-#include "SLinkedList.h"
+#include <iterator>
+#include "StackStorage.h"
 #include "TypeTraitsCheck.h"
+#include "List.h"
 
-template <typename T>
+// Storage picks how the elements are kept, see StackStorage.h
+template <typename T, typename Storage = LinkedStorage>
 class Stack
 {
-	static_assert(std::is_copy_constructible_v<T>, "Attempted to make a Stack with a type that does not implement a copy constructor");
 	static_assert(!std::is_pointer_v<T>, "Attempted to make a Stack with a raw pointer type");
 public:
-	Stack() : count_(0), list_(SLinkedList<T>()) {}
+	Stack() = default;
 
-	Stack(T data[], const size_t size) : count_(size), list_(SLinkedList<T>(data)) {}
+	Stack(T data[], const size_t size) : storage_(data, size) {}
 
-	explicit Stack(std::vector<T> data) : count_(data.size()), list_(SLinkedList<T>(data)) {}
+	explicit Stack(std::vector<T> data) : storage_(std::move(data)) {}
 
 	template <size_t N>
-	explicit Stack(std::array<T, N> data) : count_(N), list_(SLinkedList<T>(data)) {}
+	explicit Stack(std::array<T, N> data) : storage_(std::move(data)) {}
 
-	Stack(std::initializer_list<T> data) : count_(data.size()), list_(SLinkedList<T>(data)) {}
+	Stack(std::initializer_list<T> data) : storage_(data) {}
 
 	~Stack() = default;
 
-	Stack(const Stack& other) : count_(other.count_), list_(other.list_) {}
+	Stack(const Stack& other) requires std::is_copy_constructible_v<T> : storage_(other.storage_) {}
 
-	Stack& operator=(const Stack& other)
+	Stack& operator=(const Stack& other) requires std::is_copy_constructible_v<T>
 	{
 		if(this == &other) return *this;
 
-		clear();
-		count_ = other.count_;
-		list_ = other.list_;
-		
+		storage_ = other.storage_;
+
 		return *this;
 	}
 
-	Stack(Stack&& other) noexcept
-	{
-		count_ = other.count_;
-		list_ = other.list_;
-	}
+	// Takes over the storage of other, which is left empty
+	Stack(Stack&& other) noexcept : storage_(std::move(other.storage_)) {}
 
 	Stack& operator=(Stack&& other) noexcept
 	{
 		if(this == &other) return *this;
 
-		clear();
-		count_ = other.count_;
-		list_ = other.list_;
+		storage_ = std::move(other.storage_);
 
 		return *this;
 	}
 
+	void swap(Stack& other) noexcept
+	{
+		storage_.swap(other.storage_);
+	}
+
+	friend void swap(Stack& a, Stack& b) noexcept
+	{
+		a.swap(b);
+	}
+
 	template <typename U = T, std::enable_if_t<is_printable<U>::value, int> = 0>
 	friend std::ostream& operator<<(std::ostream& os, const Stack& stack)
 	{
-		os << stack.list_;
+		os << stack.storage_;
 		return os;
 	}
 
@@ -67,7 +72,7 @@ public:
 	bool operator==(const Stack& other) const
 	{
 		if(this == &other) return true;
-		return list_ == other.list_;
+		return storage_ == other.storage_;
 	}
 
 	T pop()
@@ -76,50 +81,81 @@ public:
 		{
 			throw std::out_of_range("Stack is empty");
 		}
-		count_--;
-		return list_.pop_front();
+		return storage_.pop();
 	}
 
-	[[nodiscard]] T peek() const
+	[[nodiscard]] T& peek()
 	{
-		if (empty())
+		if(empty())
+		{
+			throw std::out_of_range("Stack is empty");
+		}
+		return storage_.top();
+	}
+
+	[[nodiscard]] const T& peek() const
+	{
+		if(empty())
 		{
 			throw std::out_of_range("Stack is empty");
 		}
-		return list_.front();
+		return storage_.top();
 	}
 
 	void push(const T& data)
 	{
-		count_++;
-		list_.prepend(data);
+		storage_.emplace(data);
 	}
 
 	void push(T&& data)
 	{
-		count_++;
-		list_.prepend(std::move(data));
+		storage_.emplace(std::move(data));
+	}
+
+	template <typename... Args>
+	void emplace(Args&&... args)
+	{
+		storage_.emplace(std::forward<Args>(args)...);
+	}
+
+	// Pushes first..last in order, so the last element ends up on top
+	template <typename InputIt>
+	void push_range(InputIt first, InputIt last)
+	{
+		storage_.push_range(first, last);
+	}
+
+	// Moves up to n elements into out, top first, returns how many were popped instead of throwing when the stack runs empty
+	template <typename OutputIt>
+	size_t pop_n(OutputIt out, const size_t n)
+	{
+		return storage_.pop_n(out, n);
+	}
+
+	// Moves every element to the back of list, top first, and leaves the stack empty
+	void drain_into(List<T>& list)
+	{
+		list.reserve(list.size() + size());
+		pop_n(std::back_inserter(list), size());
 	}
 
 	void clear()
 	{
-		count_ = 0;
-		list_.clear();
+		storage_.clear();
 	}
 
 	[[nodiscard]] size_t size() const
 	{
-		return count_;
+		return storage_.size();
 	}
 
 	[[nodiscard]] bool empty() const
 	{
-		return count_ == 0;
+		return size() == 0;
 	}
 
 private:
-	size_t count_;
-	SLinkedList<T> list_;
+	typename Storage::template Container<T> storage_;
 };
 
 
@@ -0,0 +1,216 @@
+#ifndef STACK_STORAGE_H
+#define STACK_STORAGE_H
+
+#include <vector>
+#include <array>
+#include <iterator>
+#include <ostream>
+#include "SLinkedList.h"
+#include "List.h"
+#include "TypeTraitsCheck.h"
+
+// Storage policies for Stack. Both hand out the same top based interface, and are filled so that the first element of
+// an initializer or array ends up on top.
+
+// Every element lives in its own node, references to an element stay valid while others are pushed and popped
+struct LinkedStorage
+{
+	template <typename T>
+	class Container
+	{
+	public:
+		Container() = default;
+
+		Container(T data[], const size_t size) : list_(data, size) {}
+
+		explicit Container(std::vector<T> data) : list_(std::move(data)) {}
+
+		template <size_t N>
+		explicit Container(std::array<T, N> data) : list_(std::move(data)) {}
+
+		Container(std::initializer_list<T> data) : list_(data) {}
+
+		template <typename U = T, std::enable_if_t<is_printable<U>::value, int> = 0>
+		friend std::ostream& operator<<(std::ostream& os, const Container& container)
+		{
+			return os << container.list_;
+		}
+
+		template <typename U = T, std::enable_if_t<is_equatable<U>::value, int> = 0>
+		bool operator==(const Container& other) const
+		{
+			return list_ == other.list_;
+		}
+
+		[[nodiscard]] T& top()
+		{
+			return list_.front();
+		}
+
+		[[nodiscard]] const T& top() const
+		{
+			return list_.front();
+		}
+
+		template <typename... Args>
+		void emplace(Args&&... args)
+		{
+			list_.emplace_front(std::forward<Args>(args)...);
+		}
+
+		T pop()
+		{
+			return list_.pop_front();
+		}
+
+		template <typename InputIt>
+		void push_range(InputIt first, InputIt last)
+		{
+			list_.prepend_range(first, last);
+		}
+
+		template <typename OutputIt>
+		size_t pop_n(OutputIt out, const size_t n)
+		{
+			return list_.pop_front_n(out, n);
+		}
+
+		void clear() noexcept
+		{
+			list_.clear();
+		}
+
+		void swap(Container& other) noexcept
+		{
+			list_.swap(other.list_);
+		}
+
+		[[nodiscard]] size_t size() const noexcept
+		{
+			return list_.size();
+		}
+
+	private:
+		SLinkedList<T> list_;
+	};
+};
+
+// All elements share one growable array with the top at its end, so pushing does not allocate once the array is large enough.
+// The array is default constructed ahead of the elements, like the arithmetic List it is built on.
+struct ArrayStorage
+{
+	template <typename T>
+	class Container
+	{
+		static_assert(std::is_default_constructible_v<T>, "ArrayStorage needs an element type with a default constructor");
+
+	public:
+		Container() = default;
+
+		Container(T data[], const size_t size)
+		{
+			list_.reserve(size);
+			for(size_t i = size; i > 0; i--)
+				list_.append(data[i - 1]);
+		}
+
+		explicit Container(std::vector<T> data)
+		{
+			list_.reserve(data.size());
+			for(size_t i = data.size(); i > 0; i--)
+				list_.append(std::move(data[i - 1]));
+		}
+
+		template <size_t N>
+		explicit Container(std::array<T, N> data)
+		{
+			list_.reserve(N);
+			for(size_t i = N; i > 0; i--)
+				list_.append(std::move(data[i - 1]));
+		}
+
+		Container(std::initializer_list<T> data)
+		{
+			list_.reserve(data.size());
+			for(const T* p = data.end(); p != data.begin(); p--)
+				list_.append(*(p - 1));
+		}
+
+		// Prints from the top down, the same order LinkedStorage prints in
+		template <typename U = T, std::enable_if_t<is_printable<U>::value, int> = 0>
+		friend std::ostream& operator<<(std::ostream& os, const Container& container)
+		{
+			const size_t size = container.list_.size();
+			if(size == 0) return os << "{ }" << std::endl;
+			os << "{ ";
+			for(size_t i = size - 1; i > 0; i--)
+				os << container.list_.at(i) << ", ";
+			return os << container.list_.at(0) << " }" << std::endl;
+		}
+
+		template <typename U = T, std::enable_if_t<is_equatable<U>::value, int> = 0>
+		bool operator==(const Container& other) const
+		{
+			return list_ == other.list_;
+		}
+
+		[[nodiscard]] T& top()
+		{
+			return list_.back();
+		}
+
+		[[nodiscard]] const T& top() const
+		{
+			return list_.back();
+		}
+
+		template <typename... Args>
+		void emplace(Args&&... args)
+		{
+			list_.emplace_back(std::forward<Args>(args)...);
+		}
+
+		T pop()
+		{
+			return list_.pop_back();
+		}
+
+		template <typename InputIt>
+		void push_range(InputIt first, InputIt last)
+		{
+			if constexpr(std::forward_iterator<InputIt>)
+				list_.reserve(list_.size() + std::distance(first, last));
+			for(; first != last; ++first)
+				list_.append(*first);
+		}
+
+		template <typename OutputIt>
+		size_t pop_n(OutputIt out, const size_t n)
+		{
+			const size_t count = n < list_.size() ? n : list_.size();
+			for(size_t i = 0; i < count; i++, ++out)
+				*out = list_.pop_back();
+			return count;
+		}
+
+		void clear() noexcept
+		{
+			list_.clear();
+		}
+
+		void swap(Container& other) noexcept
+		{
+			list_.swap(other.list_);
+		}
+
+		[[nodiscard]] size_t size() const noexcept
+		{
+			return list_.size();
+		}
+
+	private:
+		List<T, true> list_;
+	};
+};
+
+#endif // STACK_STORAGE_H
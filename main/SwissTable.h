@@ -0,0 +1,474 @@
+#ifndef SWISS_TABLE_H
+#define SWISS_TABLE_H
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <utility>
+#include "Hashing.h"
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define SWISS_TABLE_SSE2 1
+#endif
+
+enum
+{
+	SWISS_GROUP_WIDTH = 16,
+	// The table grows once it is 7/8 full, tombstones included
+	SWISS_MAX_LOAD_NUMERATOR = 7,
+	SWISS_MAX_LOAD_DENOMINATOR = 8
+};
+
+// Open addressing hash table in the style of Abseil's Swiss table, used as the engine behind HashMap.
+// Every slot has one control byte: empty, deleted, or the low 7 bits of the hash of the element in it.
+// A lookup loads 16 control bytes at once and compares them all against the hash fragment with SSE2,
+// so only slots whose fragment matches are compared for real, and the elements themselves sit inline in one flat array.
+// KeyOf::get(element) returns the key of an element, the table itself does not care what else an element holds.
+template <typename Key, typename Element, typename KeyOf, typename Hash, typename KeyEqual>
+class SwissTable
+{
+	using Control = int8_t;
+
+	static constexpr Control EMPTY = -128;
+	static constexpr Control DELETED = -2;
+
+	// Bit i is set for every control byte i of a group that matched
+	class Mask
+	{
+	public:
+		explicit Mask(const uint32_t bits) : bits_(bits) {}
+
+		explicit operator bool() const noexcept
+		{
+			return bits_ != 0;
+		}
+
+		[[nodiscard]] size_t lowest() const noexcept
+		{
+			return static_cast<size_t>(std::countr_zero(bits_));
+		}
+
+		void clear_lowest() noexcept
+		{
+			bits_ &= bits_ - 1;
+		}
+
+	private:
+		uint32_t bits_;
+	};
+
+	class Group
+	{
+	public:
+		explicit Group(const Control* control)
+		{
+#ifdef SWISS_TABLE_SSE2
+			control_ = _mm_load_si128(reinterpret_cast<const __m128i*>(control));
+#else
+			control_ = control;
+#endif
+		}
+
+		[[nodiscard]] Mask match(const Control fragment) const noexcept
+		{
+#ifdef SWISS_TABLE_SSE2
+			return Mask(static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(fragment), control_))));
+#else
+			uint32_t bits = 0;
+			for(size_t i = 0; i < SWISS_GROUP_WIDTH; i++)
+				bits |= static_cast<uint32_t>(control_[i] == fragment) << i;
+			return Mask(bits);
+#endif
+		}
+
+		[[nodiscard]] Mask match_empty() const noexcept
+		{
+			return match(EMPTY);
+		}
+
+		// Empty and deleted are the only negative values below -1
+		[[nodiscard]] Mask match_empty_or_deleted() const noexcept
+		{
+#ifdef SWISS_TABLE_SSE2
+			return Mask(static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpgt_epi8(_mm_set1_epi8(-1), control_))));
+#else
+			uint32_t bits = 0;
+			for(size_t i = 0; i < SWISS_GROUP_WIDTH; i++)
+				bits |= static_cast<uint32_t>(control_[i] < -1) << i;
+			return Mask(bits);
+#endif
+		}
+
+	private:
+#ifdef SWISS_TABLE_SSE2
+		__m128i control_;
+#else
+		const Control* control_;
+#endif
+	};
+
+	// Visits the groups a hash can live in, jumping 1, 2, 3... groups further each time, which reaches every group once
+	class ProbeSequence
+	{
+	public:
+		ProbeSequence(const size_t hash, const size_t groupMask) : group_(hash & groupMask), mask_(groupMask), step_(0) {}
+
+		[[nodiscard]] size_t offset() const noexcept
+		{
+			return group_ * SWISS_GROUP_WIDTH;
+		}
+
+		void next() noexcept
+		{
+			step_++;
+			group_ = (group_ + step_) & mask_;
+		}
+
+	private:
+		size_t group_;
+		size_t mask_;
+		size_t step_;
+	};
+
+public:
+	explicit SwissTable(Hash hash = Hash(), KeyEqual equal = KeyEqual())
+		: control_(empty_group()), slots_(nullptr), capacity_(0), size_(0), growth_left_(0), hash_(std::move(hash)), equal_(std::move(equal)) {}
+
+	~SwissTable()
+	{
+		destroy();
+	}
+
+	SwissTable(const SwissTable& other) : SwissTable(other.hash_, other.equal_)
+	{
+		if(other.size_ == 0) return;
+
+		allocate(other.capacity_);
+		std::copy(other.control_, other.control_ + capacity_, control_);
+		for(size_t i = 0; i < capacity_; i++)
+			if(control_[i] >= 0)
+				std::construct_at(&slots_[i], static_cast<const Element&>(other.slots_[i]));
+		size_ = other.size_;
+		growth_left_ = other.growth_left_;
+	}
+
+	SwissTable& operator=(const SwissTable& other)
+	{
+		if(this == &other) return *this;
+
+		SwissTable copy(other);
+		swap(copy);
+		return *this;
+	}
+
+	SwissTable(SwissTable&& other) noexcept : SwissTable(other.hash_, other.equal_)
+	{
+		swap(other);
+	}
+
+	SwissTable& operator=(SwissTable&& other) noexcept
+	{
+		if(this == &other) return *this;
+
+		destroy();
+		control_ = empty_group();
+		slots_ = nullptr;
+		capacity_ = 0;
+		size_ = 0;
+		growth_left_ = 0;
+		swap(other);
+		return *this;
+	}
+
+	void swap(SwissTable& other) noexcept
+	{
+		std::swap(control_, other.control_);
+		std::swap(slots_, other.slots_);
+		std::swap(capacity_, other.capacity_);
+		std::swap(size_, other.size_);
+		std::swap(growth_left_, other.growth_left_);
+		std::swap(hash_, other.hash_);
+		std::swap(equal_, other.equal_);
+	}
+
+	// K is Key, or any type Hash and KeyEqual accept next to Key when they are transparent
+	template <typename K>
+	[[nodiscard]] Element* find(const K& key)
+	{
+		return find_hashed(key, table_hash(hash_, key));
+	}
+
+	template <typename K>
+	[[nodiscard]] const Element* find(const K& key) const
+	{
+		return const_cast<SwissTable*>(this)->find_hashed(key, table_hash(hash_, key));
+	}
+
+	// Hash of key the way the table uses it, for prefetch and find_hashed
+	template <typename K>
+	[[nodiscard]] size_t hash_of(const K& key) const
+	{
+		return table_hash(hash_, key);
+	}
+
+	// Starts loading the first group a lookup of hash probes, so that a later find_hashed does not wait on memory
+	void prefetch(const size_t hash) const noexcept
+	{
+		const size_t offset = ProbeSequence(hash >> 7, group_mask()).offset();
+		prefetch_address(control_ + offset);
+		prefetch_address(slots_ + offset);
+	}
+
+	template <typename K>
+	[[nodiscard]] Element* find_hashed(const K& key, const size_t hash)
+	{
+		const Control target = fragment(hash);
+		ProbeSequence sequence(hash >> 7, group_mask());
+		while(true)
+		{
+			const Group group(control_ + sequence.offset());
+			for(Mask match = group.match(target); match; match.clear_lowest())
+			{
+				Element& element = slots_[sequence.offset() + match.lowest()];
+				if(equal_(KeyOf::get(element), key)) return &element;
+			}
+			if(group.match_empty()) return nullptr;
+			sequence.next();
+		}
+	}
+
+	template <typename K>
+	[[nodiscard]] const Element* find_hashed(const K& key, const size_t hash) const
+	{
+		return const_cast<SwissTable*>(this)->find_hashed(key, hash);
+	}
+
+	// Constructs an element from args when key is not in the table yet, returns the element and whether it was inserted
+	template <typename... Args>
+	std::pair<Element*, bool> try_emplace(const Key& key, Args&&... args)
+	{
+		const size_t hash = table_hash(hash_, key);
+		if(Element* found = find_hashed(key, hash)) return { found, false };
+
+		size_t index = find_insert_slot(hash);
+		if(growth_left_ == 0 && control_[index] == EMPTY)
+		{
+			grow();
+			index = find_insert_slot(hash);
+		}
+
+		std::construct_at(&slots_[index], std::forward<Args>(args)...);
+		if(control_[index] == EMPTY)
+			growth_left_--;
+		control_[index] = fragment(hash);
+		size_++;
+		return { &slots_[index], true };
+	}
+
+	template <typename K>
+	bool erase(const K& key)
+	{
+		Element* element = find(key);
+		if(element == nullptr) return false;
+
+		const size_t index = static_cast<size_t>(element - slots_);
+		std::destroy_at(element);
+		size_--;
+
+		// A probe only continues past a group without empty slots, so a slot in a group that has one can become empty again
+		const size_t groupStart = index & ~static_cast<size_t>(SWISS_GROUP_WIDTH - 1);
+		if(Group(control_ + groupStart).match_empty())
+		{
+			control_[index] = EMPTY;
+			growth_left_++;
+		}
+		else
+			control_[index] = DELETED;
+		return true;
+	}
+
+	void clear() noexcept
+	{
+		if(capacity_ == 0) return;
+
+		for(size_t i = 0; i < capacity_; i++)
+		{
+			if(control_[i] >= 0)
+				std::destroy_at(&slots_[i]);
+			control_[i] = EMPTY;
+		}
+		size_ = 0;
+		growth_left_ = max_load(capacity_);
+	}
+
+	// Makes room for count elements so that inserting them does not grow the table
+	void reserve(const size_t count)
+	{
+		if(count <= size_ + growth_left_) return;
+		rehash(capacity_for(count));
+	}
+
+	template <typename Function>
+	void for_each(Function function)
+	{
+		for(size_t i = 0; i < capacity_; i++)
+			if(control_[i] >= 0)
+				function(slots_[i]);
+	}
+
+	template <typename Function>
+	void for_each(Function function) const
+	{
+		for(size_t i = 0; i < capacity_; i++)
+			if(control_[i] >= 0)
+				function(static_cast<const Element&>(slots_[i]));
+	}
+
+	[[nodiscard]] size_t size() const noexcept
+	{
+		return size_;
+	}
+
+	[[nodiscard]] size_t capacity() const noexcept
+	{
+		return capacity_;
+	}
+
+	// Probe length of an element is the number of groups a lookup of it loads
+	[[nodiscard]] ProbeStats probe_stats() const
+	{
+		ProbeStats stats;
+		stats.capacity = capacity_;
+		for(size_t i = 0; i < capacity_; i++)
+		{
+			if(control_[i] < 0) continue;
+
+			ProbeSequence sequence(table_hash(hash_, KeyOf::get(slots_[i])) >> 7, group_mask());
+			size_t length = 1;
+			for(; i < sequence.offset() || i >= sequence.offset() + SWISS_GROUP_WIDTH; length++)
+				sequence.next();
+			stats.record(length);
+		}
+		return stats;
+	}
+
+private:
+	Control* control_;
+	Element* slots_;
+	size_t capacity_;
+	size_t size_;
+	// Empty slots that may still be used before the table has to grow
+	size_t growth_left_;
+	Hash hash_;
+	KeyEqual equal_;
+
+	// Shared by all tables without storage, so a lookup in an empty table needs no special case
+	static Control* empty_group() noexcept
+	{
+		alignas(SWISS_GROUP_WIDTH) static Control group[SWISS_GROUP_WIDTH] = { EMPTY, EMPTY, EMPTY, EMPTY, EMPTY, EMPTY, EMPTY, EMPTY,
+		                                                                       EMPTY, EMPTY, EMPTY, EMPTY, EMPTY, EMPTY, EMPTY, EMPTY };
+		return group;
+	}
+
+	static Control fragment(const size_t hash) noexcept
+	{
+		return static_cast<Control>(hash & 0x7F);
+	}
+
+	static size_t max_load(const size_t capacity) noexcept
+	{
+		return capacity * SWISS_MAX_LOAD_NUMERATOR / SWISS_MAX_LOAD_DENOMINATOR;
+	}
+
+	static size_t capacity_for(const size_t count) noexcept
+	{
+		size_t capacity = SWISS_GROUP_WIDTH;
+		while(max_load(capacity) < count)
+			capacity *= 2;
+		return capacity;
+	}
+
+	[[nodiscard]] size_t group_mask() const noexcept
+	{
+		return capacity_ == 0 ? 0 : capacity_ / SWISS_GROUP_WIDTH - 1;
+	}
+
+	// First empty or deleted slot on the probe sequence of hash, the table always has at least one empty slot
+	[[nodiscard]] size_t find_insert_slot(const size_t hash) const
+	{
+		ProbeSequence sequence(hash >> 7, group_mask());
+		while(true)
+		{
+			const Mask free = Group(control_ + sequence.offset()).match_empty_or_deleted();
+			if(free) return sequence.offset() + free.lowest();
+			sequence.next();
+		}
+	}
+
+	// Doubles the table, or only rebuilds it when at least half of the used up room is tombstones
+	void grow()
+	{
+		if(capacity_ != 0 && size_ <= max_load(capacity_) / 2)
+			rehash(capacity_);
+		else
+			rehash(capacity_ == 0 ? static_cast<size_t>(SWISS_GROUP_WIDTH) : capacity_ * 2);
+	}
+
+	// Moves every element into a fresh table of the given capacity in one pass, which also drops all tombstones
+	void rehash(const size_t capacity)
+	{
+		Control* oldControl = control_;
+		Element* oldSlots = slots_;
+		const size_t oldCapacity = capacity_;
+
+		allocate(capacity);
+		for(size_t i = 0; i < oldCapacity; i++)
+		{
+			if(oldControl[i] < 0) continue;
+
+			const size_t hash = table_hash(hash_, KeyOf::get(oldSlots[i]));
+			const size_t index = find_insert_slot(hash);
+			std::construct_at(&slots_[index], std::move(oldSlots[i]));
+			std::destroy_at(&oldSlots[i]);
+			control_[index] = fragment(hash);
+		}
+		growth_left_ = max_load(capacity_) - size_;
+		deallocate(oldControl, oldSlots, oldCapacity);
+	}
+
+	void allocate(const size_t capacity)
+	{
+		control_ = static_cast<Control*>(::operator new(capacity, std::align_val_t(SWISS_GROUP_WIDTH)));
+		std::fill(control_, control_ + capacity, EMPTY);
+		slots_ = std::allocator<Element>().allocate(capacity);
+		capacity_ = capacity;
+		growth_left_ = max_load(capacity);
+	}
+
+	static void deallocate(Control* control, Element* slots, const size_t capacity) noexcept
+	{
+		if(capacity == 0) return;
+		::operator delete(control, std::align_val_t(SWISS_GROUP_WIDTH));
+		std::allocator<Element>().deallocate(slots, capacity);
+	}
+
+	void destroy() noexcept
+	{
+		for(size_t i = 0; i < capacity_; i++)
+			if(control_[i] >= 0)
+				std::destroy_at(&slots_[i]);
+		deallocate(control_, slots_, capacity_);
+	}
+};
+
+// Layout policy for HashMap
+struct SwissLayout
+{
+	template <typename Key, typename Element, typename KeyOf, typename Hash, typename KeyEqual>
+	using Table = SwissTable<Key, Element, KeyOf, Hash, KeyEqual>;
+};
+
+#endif // SWISS_TABLE_H
@@ -22,6 +22,12 @@ struct has_std_hash : std::false_type {};
 template <typename T>
 struct has_std_hash < T, std::void_t<decltype(std::hash<T>{}(std::declval<T>())) >> : std::true_type {};
 
+template <typename Hash, typename T, typename = void>
+struct is_hash_for : std::false_type {};
+
+template <typename Hash, typename T>
+struct is_hash_for<Hash, T, std::void_t<decltype(static_cast<size_t>(std::declval<const Hash&>()(std::declval<const T&>())))>> : std::true_type {};
+
 #endif // !TYPE_TRAITS_CHECK
 
 
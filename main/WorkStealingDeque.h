@@ -0,0 +1,174 @@
+#ifndef WORK_STEALING_DEQUE_H
+#define WORK_STEALING_DEQUE_H
+
+#include <atomic>
+#include <cstddef>
+#include <type_traits>
+#include "CacheLine.h"
+#include "HazardPointers.h"
+
+enum
+{
+	WORK_STEALING_DEQUE_CAPACITY = 64
+};
+
+// Chase-Lev deque for schedulers: one owner thread pushes and pops at the bottom, any amount of thieves steal from the top.
+// push/pop may only be called from the owner, steal from any thread. The owner only races with thieves over the last element.
+// The circular array grows when full, thieves may still be reading the old one, so it is retired through HazardPointers.
+// Elements are copied around without locks, so they have to be trivially copyable, like task handles or indices.
+template <typename T>
+class WorkStealingDeque
+{
+	static_assert(!std::is_pointer_v<T>, "Attempted to make a WorkStealingDeque with a raw pointer type");
+	static_assert(std::is_trivially_copyable_v<T>, "WorkStealingDeque needs a trivially copyable element type");
+
+	struct Array
+	{
+		const std::ptrdiff_t mask;
+		std::atomic<T>* const slots;
+
+		explicit Array(const size_t capacity) : mask(static_cast<std::ptrdiff_t>(capacity) - 1), slots(new std::atomic<T>[capacity]) {}
+
+		~Array()
+		{
+			delete[] slots;
+		}
+
+		[[nodiscard]] size_t capacity() const noexcept
+		{
+			return static_cast<size_t>(mask) + 1;
+		}
+
+		[[nodiscard]] T get(const std::ptrdiff_t index) const noexcept
+		{
+			return slots[index & mask].load(std::memory_order_relaxed);
+		}
+
+		void put(const std::ptrdiff_t index, const T& data) noexcept
+		{
+			slots[index & mask].store(data, std::memory_order_relaxed);
+		}
+	};
+
+public:
+	// The capacity is rounded up to a power of two, the deque grows past it when needed
+	explicit WorkStealingDeque(const size_t capacity = WORK_STEALING_DEQUE_CAPACITY) : top_(0), bottom_(0), array_(new Array(round_capacity(capacity))) {}
+
+	~WorkStealingDeque()
+	{
+		delete array_.load(std::memory_order_relaxed);
+	}
+
+	// Thieves hold on to the array of this deque, so it can not be copied or moved
+	WorkStealingDeque(const WorkStealingDeque& other) = delete;
+	WorkStealingDeque& operator=(const WorkStealingDeque& other) = delete;
+	WorkStealingDeque(WorkStealingDeque&& other) = delete;
+	WorkStealingDeque& operator=(WorkStealingDeque&& other) = delete;
+
+	// Owner only
+	void push(const T& data)
+	{
+		const std::ptrdiff_t bottom = bottom_.load(std::memory_order_relaxed);
+		const std::ptrdiff_t top = top_.load(std::memory_order_acquire);
+		Array* array = array_.load(std::memory_order_relaxed);
+		if(bottom - top > array->mask)
+			array = grow(array, top, bottom);
+
+		array->put(bottom, data);
+		std::atomic_thread_fence(std::memory_order_release);
+		bottom_.store(bottom + 1, std::memory_order_relaxed);
+	}
+
+	// Owner only, takes the most recently pushed element, returns false when the deque is empty
+	bool pop(T& out)
+	{
+		const std::ptrdiff_t bottom = bottom_.load(std::memory_order_relaxed) - 1;
+		Array* array = array_.load(std::memory_order_relaxed);
+		bottom_.store(bottom, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		std::ptrdiff_t top = top_.load(std::memory_order_relaxed);
+
+		if(top > bottom)
+		{
+			bottom_.store(bottom + 1, std::memory_order_relaxed);
+			return false;
+		}
+
+		out = array->get(bottom);
+		if(top < bottom) return true;
+
+		// Last element, a thief may be taking it at the same time
+		const bool won = top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+		bottom_.store(bottom + 1, std::memory_order_relaxed);
+		return won;
+	}
+
+	// Any thread, takes the oldest element, returns false when the deque is empty
+	bool steal(T& out)
+	{
+		while(true)
+		{
+			std::ptrdiff_t top = top_.load(std::memory_order_acquire);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			const std::ptrdiff_t bottom = bottom_.load(std::memory_order_acquire);
+			if(top >= bottom) return false;
+
+			// A grown array holds the same elements from top to bottom, so either one is fine to read from
+			const Array* array = HazardPointers::protect(0, array_);
+			const T data = array->get(top);
+			HazardPointers::clear(0);
+
+			// Losing means the owner or another thief took this element, try the next one
+			if(top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+			{
+				out = data;
+				return true;
+			}
+		}
+	}
+
+	// Only a snapshot when called while thieves are active
+	[[nodiscard]] size_t size() const noexcept
+	{
+		const std::ptrdiff_t top = top_.load(std::memory_order_acquire);
+		const std::ptrdiff_t bottom = bottom_.load(std::memory_order_acquire);
+		return bottom > top ? static_cast<size_t>(bottom - top) : 0;
+	}
+
+	[[nodiscard]] bool empty() const noexcept
+	{
+		return size() == 0;
+	}
+
+	// Owner only, thieves may see an older capacity
+	[[nodiscard]] size_t capacity() const noexcept
+	{
+		return array_.load(std::memory_order_relaxed)->capacity();
+	}
+
+private:
+	alignas(CACHE_LINE_SIZE) std::atomic<std::ptrdiff_t> top_;
+	alignas(CACHE_LINE_SIZE) std::atomic<std::ptrdiff_t> bottom_;
+	std::atomic<Array*> array_;
+
+	static size_t round_capacity(const size_t capacity) noexcept
+	{
+		size_t res = 2;
+		while(res < capacity)
+			res *= 2;
+		return res;
+	}
+
+	// Copies the live elements into an array twice the size, indices stay the same
+	Array* grow(Array* array, const std::ptrdiff_t top, const std::ptrdiff_t bottom)
+	{
+		Array* bigger = new Array(array->capacity() * 2);
+		for(std::ptrdiff_t i = top; i < bottom; i++)
+			bigger->put(i, array->get(i));
+		array_.store(bigger, std::memory_order_release);
+		HazardPointers::retire(array);
+		return bigger;
+	}
+};
+
+#endif // WORK_STEALING_DEQUE_H
@@ -0,0 +1,106 @@
+#include "../../main/BlockingQueue.h"
+#include <cassert>
+#include <memory>
+#include <vector>
+
+int main()
+{
+	using namespace std::chrono_literals;
+
+	BlockingQueue<int> queue(3);
+	assert(queue.capacity() == 4);
+	assert(queue.empty());
+	int value = 0;
+	const bool triedEmpty = queue.try_pop(value);
+	assert(!triedEmpty);
+	const bool timedOutEmpty = queue.pop_for(value, 1ms);
+	assert(!timedOutEmpty);
+
+	const bool triedOne = queue.try_push(1);
+	assert(triedOne);
+	const bool pushedTwo = queue.push(2);
+	assert(pushedTwo);
+	const bool emplacedThree = queue.emplace(3);
+	assert(emplacedThree);
+	const bool pushedFour = queue.push_for(4, 1ms);
+	assert(pushedFour);
+	assert(queue.size() == 4);
+	const bool triedFull = queue.try_push(5);
+	assert(!triedFull);
+	const bool timedOutFull = queue.push_for(5, 1ms);
+	assert(!timedOutFull);
+
+	const bool poppedOne = queue.pop(value);
+	assert(poppedOne && value == 1);
+	const bool triedTwo = queue.try_pop(value);
+	assert(triedTwo && value == 2);
+	const bool timedThree = queue.pop_for(value, 1ms);
+	assert(timedThree && value == 3);
+
+	queue.close();
+	assert(queue.is_closed());
+	const bool triedClosed = queue.try_push(6);
+	assert(!triedClosed);
+	const bool pushedClosed = queue.push(6);
+	assert(!pushedClosed);
+	const bool poppedFour = queue.pop(value);
+	assert(poppedFour && value == 4);
+	const bool poppedClosed = queue.pop(value);
+	assert(!poppedClosed);
+
+	{
+		BlockingQueue<std::unique_ptr<int>> pointers(2);
+		std::unique_ptr<int> ptr = std::make_unique<int>(7);
+		const bool triedSeven = pointers.try_push(std::move(ptr));
+		assert(triedSeven && ptr == nullptr);
+		const bool pushedEight = pointers.push(std::make_unique<int>(8));
+		assert(pushedEight);
+		ptr = std::make_unique<int>(9);
+		const bool triedNine = pointers.try_push(std::move(ptr));
+		assert(!triedNine && ptr != nullptr);
+		const bool poppedSeven = pointers.pop(ptr);
+		assert(poppedSeven && *ptr == 7);
+	}
+
+	// Producers are much faster than consumers and must be held back by the small capacity
+	constexpr int producers = 4;
+	constexpr int consumers = 3;
+	constexpr int perProducer = 5000;
+	BlockingQueue<int> shared(16);
+	std::atomic<long long> sum = 0;
+	std::atomic<int> popped = 0;
+	std::vector<std::thread> producerThreads;
+	std::vector<std::thread> consumerThreads;
+	for(int p = 0; p < producers; p++)
+	{
+		producerThreads.emplace_back([&shared]
+		{
+			for(int i = 0; i < perProducer; i++)
+				shared.push(i);
+		});
+	}
+	for(int c = 0; c < consumers; c++)
+	{
+		consumerThreads.emplace_back([&shared, &sum, &popped]
+		{
+			int item;
+			while(shared.pop(item))
+			{
+				assert(shared.size() <= shared.capacity());
+				sum += item;
+				popped++;
+			}
+		});
+	}
+	for(std::thread& producer : producerThreads)
+		producer.join();
+	shared.close();
+	for(std::thread& consumer : consumerThreads)
+		consumer.join();
+
+	assert(popped == producers * perProducer);
+	assert(sum == static_cast<long long>(producers) * perProducer * (perProducer - 1) / 2);
+	assert(shared.empty());
+
+	return 0;
+}
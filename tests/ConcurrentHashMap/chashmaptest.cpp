@@ -0,0 +1,137 @@
+#include "../../main/ConcurrentHashMap.h"
+#include <atomic>
+#include <cassert>
+#include <string>
+#include <thread>
+#include <vector>
+
+template <typename Layout>
+void test_threads()
+{
+	constexpr int threads = 8;
+	constexpr int perThread = 20000;
+	ConcurrentHashMap<int, int, Layout> map(16);
+
+	// Writers on disjoint ranges while readers look at everything
+	std::vector<std::thread> workers;
+	for(int t = 0; t < threads; t++)
+	{
+		workers.emplace_back([&map, t]
+		{
+			for(int i = t * perThread; i < (t + 1) * perThread; i++)
+			{
+				const bool inserted = map.insert(i, i);
+				assert(inserted);
+				const std::optional<int> found = map.find((i * 7) % (threads * perThread));
+				assert(!found || *found == (i * 7) % (threads * perThread));
+			}
+		});
+	}
+	for(std::thread& worker : workers)
+		worker.join();
+	workers.clear();
+	assert(map.size() == threads * perThread);
+	for(int i = 0; i < threads * perThread; i++)
+		assert(map.find(i) == i);
+
+	// Every thread races for the same keys, each value may only be created once
+	std::atomic<int> created = 0;
+	for(int t = 0; t < threads; t++)
+	{
+		workers.emplace_back([&map, &created]
+		{
+			for(int i = 0; i < perThread; i++)
+			{
+				const int value = map.compute_if_absent(-1 - i, [&]
+				{
+					created++;
+					return i;
+				});
+				assert(value == i);
+				map.update(i, [](int& current) { current++; });
+			}
+		});
+	}
+	for(std::thread& worker : workers)
+		worker.join();
+	workers.clear();
+	assert(created == perThread);
+	for(int i = 0; i < perThread; i++)
+		assert(map.find(i) == i + threads);
+
+	// Erasing and reinserting the same keys from every thread
+	std::atomic<int> erased = 0;
+	for(int t = 0; t < threads; t++)
+	{
+		workers.emplace_back([&map, &erased, t]
+		{
+			for(int i = 0; i < perThread; i++)
+			{
+				if(map.erase(-1 - i)) erased++;
+				map.insert_or_assign(t * perThread + i, -i);
+			}
+		});
+	}
+	for(std::thread& worker : workers)
+		worker.join();
+	assert(erased == perThread);
+	assert(map.size() == threads * perThread);
+	for(int i = 0; i < threads * perThread; i++)
+		assert(map.find(i) == -(i % perThread));
+}
+
+int main()
+{
+	ConcurrentHashMap<std::string, int> map(5);
+	assert(map.shard_count() == 8);
+	assert(map.empty());
+	assert(!map.find("a"));
+	const bool insertedA = map.insert("a", 1);
+	assert(insertedA);
+	const bool insertedAgain = map.insert("a", 2);
+	assert(!insertedAgain);
+	assert(map.find("a") == 1);
+	const bool assignedA = map.insert_or_assign("a", 3);
+	assert(!assignedA);
+	const bool assignedB = map.insert_or_assign("b", 4);
+	assert(assignedB);
+	assert(map.find("a") == 3);
+	assert(map.size() == 2);
+	assert(map.contains("b"));
+
+	int seen = 0;
+	const bool foundB = map.find("b", [&](const int& value) { seen = value; });
+	assert(foundB && seen == 4);
+	const bool foundC = map.find("c", [&](const int&) { seen = -1; });
+	assert(!foundC && seen == 4);
+	const bool updatedB = map.update("b", [](int& value) { value *= 10; });
+	assert(updatedB);
+	assert(map.find("b") == 40);
+	const bool updatedC = map.update("c", [](int& value) { value = 0; });
+	assert(!updatedC);
+
+	const int existing = map.compute_if_absent("b", [] { return -1; });
+	assert(existing == 40);
+	const int computed = map.compute_if_absent("c", [] { return 5; });
+	assert(computed == 5);
+	assert(map.find("c") == 5);
+
+	int sum = 0;
+	map.for_each([&](const std::string&, const int& value) { sum += value; });
+	assert(sum == 3 + 40 + 5);
+
+	const bool erasedA = map.erase("a");
+	assert(erasedA);
+	const bool erasedAgain = map.erase("a");
+	assert(!erasedAgain);
+	assert(!map.contains("a"));
+	map.reserve(1000);
+	assert(map.size() == 2 && map.find("c") == 5);
+	map.clear();
+	assert(map.empty());
+
+	test_threads<SwissLayout>();
+	test_threads<RobinHoodLayout>();
+
+	return 0;
+}
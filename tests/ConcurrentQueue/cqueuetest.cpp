@@ -0,0 +1,107 @@
+#include "../../main/ConcurrentQueue.h"
+#include <cassert>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+int main()
+{
+	ConcurrentQueue<int> queue;
+	assert(queue.empty());
+	int value = 0;
+	const bool poppedEmpty = queue.try_pop(value);
+	assert(!poppedEmpty);
+	queue.push(1);
+	queue.push(2);
+	queue.emplace(3);
+	assert(!queue.empty());
+	const bool poppedOne = queue.try_pop(value);
+	assert(poppedOne && value == 1);
+	const bool poppedTwo = queue.try_pop(value);
+	assert(poppedTwo && value == 2);
+	const bool poppedThree = queue.try_pop(value);
+	assert(poppedThree && value == 3);
+	assert(queue.empty());
+	const bool poppedDrained = queue.try_pop(value);
+	assert(!poppedDrained);
+
+	{
+		ConcurrentQueue<std::unique_ptr<int>> pointers;
+		pointers.push(std::make_unique<int>(5));
+		pointers.push(std::make_unique<int>(6));
+		std::unique_ptr<int> ptr;
+		const bool poppedPointer = pointers.try_pop(ptr);
+		assert(poppedPointer && *ptr == 5);
+	}
+
+	// A constructor that throws leaves nothing behind in the queue
+	{
+		struct Throwing
+		{
+			explicit Throwing(const bool fail)
+			{
+				if(fail) throw std::runtime_error("construction failed");
+			}
+		};
+		ConcurrentQueue<Throwing> throwing;
+		bool threw = false;
+		try
+		{
+			throwing.emplace(true);
+		}
+		catch(const std::runtime_error&)
+		{
+			threw = true;
+		}
+		assert(threw && throwing.empty());
+		throwing.emplace(false);
+		assert(!throwing.empty());
+	}
+
+	// Every producer pushes increasing values, so every consumer must see each producer's values in order
+	constexpr int producers = 4;
+	constexpr int consumers = 4;
+	constexpr int perProducer = 20000;
+	ConcurrentQueue<std::pair<int, int>> shared;
+	std::atomic<int> popped = 0;
+	std::atomic<long long> sum = 0;
+	std::vector<std::thread> workers;
+	for(int p = 0; p < producers; p++)
+	{
+		workers.emplace_back([&shared, p]
+		{
+			for(int i = 0; i < perProducer; i++)
+				shared.emplace(p, i);
+		});
+	}
+	for(int c = 0; c < consumers; c++)
+	{
+		workers.emplace_back([&shared, &popped, &sum]
+		{
+			int last[producers];
+			for(int& l : last)
+				l = -1;
+			std::pair<int, int> item;
+			while(popped.load() < producers * perProducer)
+			{
+				if(shared.try_pop(item))
+				{
+					assert(item.second > last[item.first]);
+					last[item.first] = item.second;
+					sum += item.second;
+					popped++;
+				}
+			}
+		});
+	}
+	for(std::thread& worker : workers)
+		worker.join();
+
+	assert(popped == producers * perProducer);
+	assert(sum == static_cast<long long>(producers) * perProducer * (perProducer - 1) / 2);
+	assert(shared.empty());
+	HazardPointers::reclaim();
+
+	return 0;
+}
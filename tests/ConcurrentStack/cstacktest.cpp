@@ -0,0 +1,75 @@
+#include "../../main/ConcurrentStack.h"
+#include <cassert>
+#include <memory>
+#include <vector>
+
+template <bool UseElimination>
+void run_threads()
+{
+	constexpr int threads = 4;
+	constexpr int perThread = 20000;
+	ConcurrentStack<int, UseElimination> stack;
+	std::atomic<long long> poppedSum = 0;
+	std::atomic<int> popped = 0;
+
+	std::vector<std::thread> workers;
+	for(int t = 0; t < threads; t++)
+	{
+		workers.emplace_back([&stack, t]
+		{
+			for(int i = 0; i < perThread; i++)
+				stack.push(t * perThread + i);
+		});
+		workers.emplace_back([&stack, &poppedSum, &popped]
+		{
+			int value;
+			while(popped.load() < threads * perThread)
+			{
+				if(stack.try_pop(value))
+				{
+					poppedSum += value;
+					popped++;
+				}
+			}
+		});
+	}
+	for(std::thread& worker : workers)
+		worker.join();
+
+	const long long total = static_cast<long long>(threads) * perThread;
+	assert(popped == total);
+	assert(poppedSum == total * (total - 1) / 2);
+	assert(stack.empty());
+}
+
+int main()
+{
+	ConcurrentStack<int> stack;
+	assert(stack.empty());
+	int value = 0;
+	const bool poppedEmpty = stack.try_pop(value);
+	assert(!poppedEmpty);
+	stack.push(1);
+	stack.push(2);
+	assert(!stack.empty());
+	const bool poppedTwo = stack.try_pop(value);
+	assert(poppedTwo && value == 2);
+	const bool poppedOne = stack.try_pop(value);
+	assert(poppedOne && value == 1);
+	assert(stack.empty());
+
+	ConcurrentStack<std::unique_ptr<int>> pointers;
+	pointers.push(std::make_unique<int>(5));
+	pointers.emplace(new int(6));
+	std::unique_ptr<int> ptr;
+	const bool poppedPointer = pointers.try_pop(ptr);
+	assert(poppedPointer && *ptr == 6);
+	pointers.clear();
+	assert(pointers.empty());
+
+	run_threads<false>();
+	run_threads<true>();
+	HazardPointers::reclaim();
+
+	return 0;
+}
@@ -0,0 +1,128 @@
+#include "../../main/FrozenHashMap.h"
+#include <cassert>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+// Every key lands on the same hash
+struct Colliding
+{
+	int value = 0;
+	bool operator==(const Colliding& other) const = default;
+};
+
+template <>
+struct std::hash<Colliding>
+{
+	size_t operator()(const Colliding&) const noexcept
+	{
+		return 42;
+	}
+};
+
+template <typename Hash>
+void test_numbers()
+{
+	HashMap<long long, long long, SwissLayout, Hash> source;
+	for(long long i = 0; i < 200000; i++)
+		source.insert(i * 1000003, i);
+	const FrozenHashMap<long long, long long, Hash> frozen(source);
+	assert(frozen.size() == 200000);
+	for(long long i = 0; i < 200000; i++)
+	{
+		assert(frozen.at(i * 1000003) == i);
+		assert(!frozen.contains_key(i * 1000003 + 1));
+	}
+
+	// Every slot holds exactly one of the keys
+	long long sum = 0;
+	size_t count = 0;
+	frozen.for_each([&](const long long&, const long long& value)
+	{
+		sum += value;
+		count++;
+	});
+	assert(count == 200000 && sum == 199999LL * 200000 / 2);
+}
+
+int main()
+{
+	FrozenHashMap<std::string, int> empty;
+	assert(empty.empty() && empty.find("a") == nullptr);
+	bool threw = false;
+	try
+	{
+		(void)empty.at("a");
+	}
+	catch(const std::out_of_range&)
+	{
+		threw = true;
+	}
+	assert(threw);
+
+	HashMap<std::string, int> words;
+	for(int i = 0; i < 5000; i++)
+		words.insert("word" + std::to_string(i), i);
+	FrozenHashMap<std::string, int> frozen(words);
+	assert(frozen.size() == 5000);
+	for(int i = 0; i < 5000; i++)
+		assert(*frozen.find("word" + std::to_string(i)) == i);
+	assert(frozen.at(std::string_view("word42")) == 42);
+	assert(frozen.contains_key("word4999"));
+	assert(!frozen.contains_key("word5000"));
+	assert(frozen.find(std::string_view("")) == nullptr);
+	struct Label
+	{
+		operator std::string() const
+		{
+			return "word7";
+		}
+	};
+	assert(frozen.at(Label{}) == 7);
+
+	// The snapshot does not follow the source
+	words.insert("word0", -1);
+	assert(frozen.at("word0") == 0);
+
+	FrozenHashMap<std::string, int> copy(frozen);
+	assert(copy.size() == 5000 && copy.at("word7") == 7);
+	FrozenHashMap<std::string, int> moved(std::move(copy));
+	assert(copy.empty() && !copy.contains_key("word7"));
+	assert(moved.at("word7") == 7);
+	copy = moved;
+	assert(copy.at("word8") == 8);
+	swap(copy, empty);
+	assert(copy.empty() && empty.at("word9") == 9);
+
+	// Pairs from a range, the last value of a repeated key wins
+	const std::vector<std::pair<int, std::string>> pairs = { { 1, "one" }, { 2, "two" }, { 1, "uno" } };
+	const FrozenHashMap<int, std::string> small(pairs.begin(), pairs.end());
+	assert(small.size() == 2);
+	assert(small.at(1) == "uno" && small.at(2) == "two");
+	assert(!small.contains_key(3));
+	const std::vector<std::pair<int, int>> single = { { 5, 6 } };
+	const FrozenHashMap<int, int> one(single.begin(), single.end());
+	assert(one.at(5) == 6 && !one.contains_key(6));
+
+	test_numbers<DefaultHash<long long>>();
+	test_numbers<FastHash<long long>>();
+
+	// Keys whose hashes are equal can not be told apart by any pilot
+	HashMap<Colliding, int> colliding;
+	colliding[Colliding{ 1 }] = 1;
+	colliding[Colliding{ 2 }] = 2;
+	threw = false;
+	try
+	{
+		FrozenHashMap<Colliding, int> broken(colliding);
+	}
+	catch(const std::invalid_argument&)
+	{
+		threw = true;
+	}
+	assert(threw);
+
+	return 0;
+}
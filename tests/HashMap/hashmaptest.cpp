@@ -0,0 +1,374 @@
+#include "../../main/HashMap.h"
+#include <cassert>
+#include <cstdint>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Every key lands on the same hash
+struct Colliding
+{
+	int value = 0;
+	bool operator==(const Colliding& other) const = default;
+};
+
+template <>
+struct std::hash<Colliding>
+{
+	size_t operator()(const Colliding&) const noexcept
+	{
+		return 42;
+	}
+};
+
+// Only a few different hashes, so runs get long enough to saturate Robin Hood distances and overlap each other
+struct Clustered
+{
+	static inline int clusters = 1;
+	int value = 0;
+	bool operator==(const Clustered& other) const = default;
+};
+
+template <>
+struct std::hash<Clustered>
+{
+	size_t operator()(const Clustered& key) const noexcept
+	{
+		return static_cast<size_t>(key.value % Clustered::clusters);
+	}
+};
+
+// Default construction throws while fail is set, the text lives on the heap so a slot destroyed twice does not go unnoticed
+struct Fragile
+{
+	static inline bool fail = false;
+	std::string text = std::string(32, 'x');
+
+	Fragile()
+	{
+		if(fail) throw std::runtime_error("construction failed");
+	}
+
+	bool operator==(const Fragile& other) const = default;
+};
+
+template <typename Map, typename K>
+constexpr bool can_find = requires(const Map& map, const K& key)
+{
+	map.find(key);
+};
+
+// Ids strided far apart, like tagged ids with a counter in their top bits, through the default hash
+template <typename Layout>
+void test_strided()
+{
+	HashMap<long long, int, Layout> strided;
+	for(int i = 0; i < 50000; i++)
+		strided.insert(static_cast<long long>(i) << 48, i);
+	for(int i = 0; i < 50000; i++)
+		assert(strided.at(static_cast<long long>(i) << 48) == i);
+	assert(!strided.contains_key(1) && !strided.contains_key(1ll << 47));
+	const ProbeStats stats = strided.probe_stats();
+	assert(stats.elements == 50000);
+	assert(stats.average() < 2.0 && stats.longest < PROBE_HISTOGRAM_SIZE);
+}
+
+template <typename Layout>
+void test_layout()
+{
+	// Enough keys to grow the table several times, then erase every other one
+	HashMap<int, int, Layout> numbers;
+	for(int i = 0; i < 100000; i++)
+		numbers[i * 128] = i;
+	assert(numbers.size() == 100000);
+	for(int i = 0; i < 100000; i++)
+		assert(numbers.at(i * 128) == i);
+	for(int i = 0; i < 100000; i += 2)
+	{
+		const bool removed = numbers.remove(i * 128);
+		assert(removed);
+	}
+	assert(numbers.size() == 50000);
+	for(int i = 0; i < 100000; i++)
+		assert(numbers.contains_key(i * 128) == (i % 2 == 1));
+	// Churn on the same keys has to reuse tombstones instead of growing forever
+	for(int round = 0; round < 10; round++)
+	{
+		for(int i = 0; i < 100000; i += 2)
+			numbers.insert(i * 128, round);
+		for(int i = 0; i < 100000; i += 2)
+		{
+			const bool removed = numbers.remove(i * 128);
+			assert(removed);
+		}
+	}
+	assert(numbers.size() == 50000);
+
+	// Reserving up front means a bulk load never grows the table
+	HashMap<int, int, Layout> reserved;
+	assert(reserved.capacity() == 0 && reserved.load_factor() == 0.0);
+	reserved.reserve(10000);
+	const size_t capacity = reserved.capacity();
+	assert(capacity >= 10000 && (capacity & (capacity - 1)) == 0);
+	for(int i = 0; i < 10000; i++)
+		reserved.insert(i, i);
+	assert(reserved.capacity() == capacity);
+	assert(reserved.load_factor() > 0.5 && reserved.load_factor() < 0.9);
+	reserved.reserve(100);
+	assert(reserved.capacity() == capacity);
+
+	// Batches longer than one prefetch round, with hits and misses mixed
+	std::vector<int> keys;
+	for(int i = 0; i < 100; i++)
+		keys.push_back(i * 128);
+	std::vector<int*> values(keys.size());
+	const size_t found = numbers.find_batch(keys.data(), keys.size(), values.data());
+	assert(found == 50);
+	for(int i = 0; i < 100; i++)
+		assert(i % 2 == 1 ? *values[i] == i : values[i] == nullptr);
+	*values[1] = -1;
+	assert(numbers.at(128) == -1);
+	numbers.insert(128, 1);
+	const HashMap<int, int, Layout>& constNumbers = numbers;
+	std::vector<const int*> constValues(keys.size());
+	const size_t constFound = constNumbers.find_batch(keys.data(), keys.size(), constValues.data());
+	assert(constFound == 50);
+	assert(*constValues[99] == 99);
+	bool present[100];
+	const size_t contained = numbers.contains_batch(keys.data(), keys.size(), present);
+	assert(contained == 50);
+	for(int i = 0; i < 100; i++)
+		assert(present[i] == (i % 2 == 1));
+	const size_t containedNone = numbers.contains_batch(keys.data(), 0, present);
+	assert(containedNone == 0);
+
+	HashMap<int, int, Layout> copy(numbers);
+	assert(copy.size() == 50000 && copy.at(1 * 128) == 1);
+	HashMap<int, int, Layout> moved(std::move(copy));
+	assert(copy.empty() && !copy.contains_key(128));
+	assert(moved.size() == 50000);
+	copy[5] = 5;
+	swap(copy, moved);
+	assert(copy.size() == 50000 && moved.size() == 1);
+	moved = copy;
+	assert(moved.size() == 50000 && moved.at(3 * 128) == 3);
+	moved.clear();
+	assert(moved.empty() && !moved.contains_key(128));
+	moved[1] = 1;
+	assert(moved.at(1) == 1);
+
+	// A broken hash makes lookups slow but must not break the map
+	HashMap<Colliding, int, Layout> colliding;
+	for(int i = 0; i < 200; i++)
+		colliding[Colliding{ i }] = i;
+	for(int i = 0; i < 200; i += 2)
+	{
+		const bool removed = colliding.remove(Colliding{ i });
+		assert(removed);
+	}
+	for(int i = 0; i < 200; i++)
+		assert(colliding.contains_key(Colliding{ i }) == (i % 2 == 1));
+
+	// Random inserts and erases on long overlapping runs, checked against a plain array
+	std::mt19937 random(1);
+	for(Clustered::clusters = 1; Clustered::clusters <= 4; Clustered::clusters++)
+	{
+		HashMap<Clustered, int, Layout> clustered;
+		std::vector<bool> inserted(3000, false);
+		for(int round = 0; round < 20000; round++)
+		{
+			const int value = static_cast<int>(random() % 3000);
+			if(random() % 3 == 0)
+			{
+				const bool removed = clustered.remove(Clustered{ value });
+				assert(removed == inserted[value]);
+				inserted[value] = false;
+			}
+			else
+			{
+				clustered.insert(Clustered{ value }, value);
+				inserted[value] = true;
+			}
+		}
+		size_t expected = 0;
+		for(int i = 0; i < 3000; i++)
+		{
+			assert(clustered.contains_key(Clustered{ i }) == inserted[i]);
+			expected += inserted[i];
+		}
+		assert(clustered.size() == expected);
+	}
+
+	// A value that throws while it is constructed leaves the map as it was, also when the insert had to shift other entries
+	HashMap<int, Fragile, Layout> fragile;
+	for(int i = 0; i < 1000; i++)
+		fragile[i * 3];
+	Fragile::fail = true;
+	int failed = 0;
+	for(int i = 0; i < 1000; i++)
+	{
+		try
+		{
+			fragile[i * 3 + 1];
+		}
+		catch(const std::runtime_error&)
+		{
+			failed++;
+		}
+	}
+	Fragile::fail = false;
+	assert(failed == 1000 && fragile.size() == 1000);
+	for(int i = 0; i < 1000; i++)
+	{
+		assert(fragile.at(i * 3).text.size() == 32);
+		assert(!fragile.contains_key(i * 3 + 1));
+	}
+}
+
+int main()
+{
+	HashMap<std::string, int> map;
+	assert(map.empty());
+	assert(!map.contains_key("a"));
+	map["a"] = 1;
+	map.insert("b", 2);
+	assert(map.size() == 2);
+	assert(map.contains_key("a"));
+	assert(map.at("b") == 2);
+	assert(map.contains_value(2));
+	assert(!map.contains_value(3));
+	map.insert("b", 3);
+	assert(map.size() == 2);
+	assert(map["b"] == 3);
+	const bool emplacedB = map.try_emplace("b", 4);
+	assert(!emplacedB);
+	const bool emplacedC = map.try_emplace("c", 4);
+	assert(emplacedC);
+	assert(*map.find("c") == 4);
+	assert(map.find("d") == nullptr);
+	bool threw = false;
+	try
+	{
+		(void)map.at("d");
+	}
+	catch(const std::out_of_range&)
+	{
+		threw = true;
+	}
+	assert(threw);
+
+	// Transparent lookups by string_view and const char* do not build a std::string
+	const std::string_view view = "bc";
+	assert(map.contains_key(view.substr(0, 1)));
+	assert(map.at(view.substr(0, 1)) == 3);
+	assert(*map.find(view.substr(1)) == 4);
+	assert(map.find(std::string_view("e")) == nullptr);
+	const char* name = "c";
+	assert(map.contains_key(name));
+	const HashMap<std::string, int>& constMap = map;
+	assert(constMap.at(name) == 4 && *constMap.find(std::string_view("b")) == 3);
+	// Types the hash does not take go through the T overloads, converted to std::string when they can be and rejected otherwise
+	struct Label
+	{
+		operator std::string() const
+		{
+			return "b";
+		}
+	};
+	assert(map.contains_key(Label{}) && map.at(Label{}) == 3);
+	static_assert(can_find<HashMap<std::string, int>, std::string_view> && !can_find<HashMap<std::string, int>, int>);
+	static_assert(!can_find<HashMap<int, int>, std::string_view>);
+
+	const bool removedA = map.remove("a");
+	assert(removedA);
+	const bool removedAgain = map.remove("a");
+	assert(!removedAgain);
+	assert(!map.contains_key("a"));
+	assert(map.size() == 2);
+	const std::string_view names[] = { "b", "x", "c" };
+	bool present[3];
+	const size_t contained = map.contains_batch(names, 3, present);
+	assert(contained == 2);
+	assert(present[0] && !present[1] && present[2]);
+	const bool removedC = map.remove(std::string_view("c"));
+	assert(removedC);
+	assert(!map.contains_key(std::string_view("c")));
+	map["c"] = 4;
+
+	test_layout<SwissLayout>();
+	test_layout<RobinHoodLayout>();
+
+	// Ids that only differ in their top bits, like tagged or pointer-like ids, have to spread through the default hash as well
+	HashMap<uint64_t, int> tagged;
+	for(int i = 0; i < 20000; i++)
+		tagged.insert(static_cast<uint64_t>(i) << 48, i);
+	const ProbeStats taggedStats = tagged.probe_stats();
+	assert(taggedStats.elements == 20000);
+	assert(taggedStats.average() < 1.5 && taggedStats.longest < 8);
+
+	test_strided<SwissLayout>();
+	test_strided<RobinHoodLayout>();
+
+	// Strided ids through FastHash, which skips the mixing step of the tables
+	HashMap<long long, int, SwissLayout, FastHash<long long>> strided;
+	for(int i = 0; i < 50000; i++)
+		strided.insert(static_cast<long long>(i) << 20, i);
+	for(int i = 0; i < 50000; i++)
+		assert(strided.at(static_cast<long long>(i) << 20) == i);
+	assert(!strided.contains_key(1));
+	const ProbeStats stridedStats = strided.probe_stats();
+	assert(stridedStats.elements == 50000 && stridedStats.capacity == strided.capacity());
+	assert(stridedStats.average() < 1.5);
+	size_t counted = 0;
+	for(const size_t bucket : stridedStats.histogram)
+		counted += bucket;
+	assert(counted == 50000 && stridedStats.histogram[0] > 40000);
+
+	HashMap<std::string, int, RobinHoodLayout, FastHash<std::string>> words;
+	for(int i = 0; i < 1000; i++)
+		words.insert(std::string(static_cast<size_t>(i % 100), 'x') + std::to_string(i), i);
+	for(int i = 0; i < 1000; i++)
+		assert(words.at(std::string(static_cast<size_t>(i % 100), 'x') + std::to_string(i)) == i);
+	assert(words.contains_key(std::string_view("x1")) && !words.contains_key("x"));
+	assert(words.probe_stats().average() < 3.0);
+
+	// Equal bytes hash equal whatever their alignment, and every length gets a different hash
+	const std::string text = "The quick brown fox jumps over the lazy dog, then jumps over it again and again";
+	for(size_t length = 0; length < text.size(); length++)
+	{
+		const std::string copy = " " + text.substr(0, length);
+		assert(hash_bytes(text.data(), length) == hash_bytes(copy.data() + 1, length));
+		assert(hash_bytes(text.data(), length) != hash_bytes(text.data(), length + 1));
+		assert(hash_bytes(text.data(), length) != hash_bytes(text.data(), length, 1));
+	}
+
+	// Colliding keys show up in the diagnostics
+	HashMap<Colliding, int> bad;
+	for(int i = 0; i < 100; i++)
+		bad[Colliding{ i }] = i;
+	assert(bad.probe_stats().longest > 1);
+	HashMap<Colliding, int, RobinHoodLayout> badRobinHood;
+	for(int i = 0; i < 100; i++)
+		badRobinHood[Colliding{ i }] = i;
+	const ProbeStats badStats = badRobinHood.probe_stats();
+	assert(badStats.longest == 100 && badStats.histogram[PROBE_HISTOGRAM_SIZE - 1] == 100 - PROBE_HISTOGRAM_SIZE + 1);
+
+	// Robin Hood distances saturate at a byte, colliding keys past that still go in and are found by comparing keys
+	HashMap<Colliding, int, RobinHoodLayout> saturated;
+	for(int i = 0; i < 1000; i++)
+		saturated[Colliding{ i }] = i;
+	assert(saturated.size() == 1000 && saturated.probe_stats().longest == 1000);
+	for(int i = 0; i < 1000; i += 2)
+	{
+		const bool removed = saturated.remove(Colliding{ i });
+		assert(removed);
+	}
+	saturated.reserve(4000);
+	for(int i = 0; i < 1000; i++)
+		assert(saturated.contains_key(Colliding{ i }) == (i % 2 == 1));
+	assert(saturated.probe_stats().longest == 500);
+
+	return 0;
+}
@@ -0,0 +1,110 @@
+#include "../../main/HashSet.h"
+#include <cassert>
+#include <string>
+#include <string_view>
+#include <vector>
+
+template <typename Layout>
+void test_layout()
+{
+	HashSet<int, Layout> set;
+	assert(set.empty());
+	const bool inserted = set.insert(1);
+	assert(inserted);
+	const bool insertedAgain = set.insert(1);
+	assert(!insertedAgain);
+	assert(set.contains(1) && !set.contains(2));
+	const bool erased = set.erase(1);
+	assert(erased);
+	const bool erasedAgain = set.erase(1);
+	assert(!erasedAgain);
+	assert(set.empty());
+
+	std::vector<int> numbers;
+	for(int i = 0; i < 10000; i++)
+		numbers.push_back(i % 5000);
+	const size_t added = set.insert_range(numbers.begin(), numbers.end());
+	assert(added == 5000);
+	assert(set.size() == 5000);
+	for(int i = 0; i < 5000; i++)
+		assert(set.contains(i));
+
+	// Evens below 6000 against multiples of three below 3000, in both size orders
+	HashSet<int, Layout> evens;
+	HashSet<int, Layout> threes;
+	for(int i = 0; i < 6000; i += 2)
+		evens.insert(i);
+	for(int i = 0; i < 3000; i += 3)
+		threes.insert(i);
+
+	HashSet<int, Layout> both = evens;
+	both.intersect_with(threes);
+	HashSet<int, Layout> both2 = threes;
+	both2.intersect_with(evens);
+	assert(both == both2);
+	assert(both.size() == 500);
+	for(int i = 0; i < 3000; i += 6)
+		assert(both.contains(i));
+
+	HashSet<int, Layout> either = evens;
+	either.union_with(threes);
+	HashSet<int, Layout> either2 = threes;
+	either2.union_with(evens);
+	assert(either == either2);
+	assert(either.size() == 3000 + 1000 - 500);
+
+	HashSet<int, Layout> onlyEvens = evens;
+	onlyEvens.difference_with(threes);
+	assert(onlyEvens.size() == 3000 - 500);
+	assert(onlyEvens.contains(2) && !onlyEvens.contains(6) && onlyEvens.contains(5994));
+	HashSet<int, Layout> onlyThrees = threes;
+	onlyThrees.difference_with(evens);
+	assert(onlyThrees.size() == 1000 - 500);
+	assert(onlyThrees.contains(3) && !onlyThrees.contains(6));
+
+	onlyThrees.union_with(onlyThrees);
+	assert(onlyThrees.size() == 500);
+	onlyThrees.intersect_with(onlyThrees);
+	assert(onlyThrees.size() == 500);
+	onlyThrees.difference_with(onlyThrees);
+	assert(onlyThrees.empty());
+
+	HashSet<int, Layout> moved(std::move(either));
+	assert(either.empty() && moved.size() == 3500);
+	swap(moved, either);
+	assert(moved.empty() && either.size() == 3500);
+	either.clear();
+	assert(either.empty() && !either.contains(0));
+}
+
+int main()
+{
+	HashSet<std::string> words = { "a", "b", "c", "a" };
+	assert(words.size() == 3);
+	assert(words.contains("a"));
+	assert(words.contains(std::string_view("b")));
+	assert(!words.contains("d"));
+	struct Label
+	{
+		operator std::string() const
+		{
+			return "a";
+		}
+	};
+	assert(words.contains(Label{}));
+	const bool erasedC = words.erase(std::string_view("c"));
+	assert(erasedC);
+	assert(!words.contains("c"));
+	std::string word = "e";
+	const bool insertedE = words.insert(std::move(word));
+	assert(insertedE);
+	assert(words.contains("e"));
+	size_t length = 0;
+	words.for_each([&](const std::string& element) { length += element.size(); });
+	assert(length == 3);
+
+	test_layout<SwissLayout>();
+	test_layout<RobinHoodLayout>();
+
+	return 0;
+}
@@ -0,0 +1,142 @@
+#include "../../main/IndexedHeap.h"
+#include <cassert>
+#include <functional>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+int main()
+{
+	IndexedHeap<int> heap;
+	assert(heap.empty());
+	const size_t five = heap.push(5);
+	const size_t three = heap.push(3);
+	const size_t eight = heap.emplace(8);
+	assert(heap.size() == 3);
+	assert(heap.top() == 3);
+	assert(heap.top_handle() == three);
+
+	heap.decrease_key(eight, 1);
+	assert(heap.top() == 1);
+	assert(heap.top_handle() == eight);
+	heap.increase_key(eight, 10);
+	assert(heap.top() == 3);
+	assert(heap.get(eight) == 10);
+
+	bool threw = false;
+	try
+	{
+		heap.decrease_key(five, 6);
+	}
+	catch(const std::invalid_argument&)
+	{
+		threw = true;
+	}
+	assert(threw);
+
+	const int erased = heap.erase(three);
+	assert(erased == 3);
+	assert(!heap.contains(three));
+	assert(heap.top() == 5);
+	threw = false;
+	try
+	{
+		heap.erase(three);
+	}
+	catch(const std::out_of_range&)
+	{
+		threw = true;
+	}
+	assert(threw);
+	const int first = heap.pop();
+	assert(first == 5);
+	const int second = heap.pop();
+	assert(second == 10);
+	assert(heap.empty());
+
+	// Dijkstra on a small graph, every node is pushed once and only updated afterwards
+	constexpr int nodes = 6;
+	const int weights[nodes][nodes] = {
+		{ 0, 7, 9, 0, 0, 14 },
+		{ 7, 0, 10, 15, 0, 0 },
+		{ 9, 10, 0, 11, 0, 2 },
+		{ 0, 15, 11, 0, 6, 0 },
+		{ 0, 0, 0, 6, 0, 9 },
+		{ 14, 0, 2, 0, 9, 0 }
+	};
+	struct Distance
+	{
+		int distance = 0;
+		int node = 0;
+
+		bool operator<(const Distance& other) const
+		{
+			return distance < other.distance;
+		}
+	};
+	IndexedHeap<Distance, std::less<Distance>, 4> frontier;
+	std::vector<size_t> handles(nodes);
+	std::vector<int> distances(nodes, 1 << 30);
+	distances[0] = 0;
+	for(int i = 0; i < nodes; i++)
+		handles[i] = frontier.push(Distance{ distances[i], i });
+	while(!frontier.empty())
+	{
+		const Distance current = frontier.pop();
+		for(int next = 0; next < nodes; next++)
+		{
+			if(weights[current.node][next] == 0 || !frontier.contains(handles[next])) continue;
+			const int candidate = current.distance + weights[current.node][next];
+			if(candidate < distances[next])
+			{
+				distances[next] = candidate;
+				frontier.decrease_key(handles[next], Distance{ candidate, next });
+			}
+		}
+	}
+	assert(distances[4] == 20);
+	assert(distances[5] == 11);
+	assert(distances[3] == 20);
+
+	// Random updates and erases checked against a plain array
+	std::mt19937 random(42);
+	IndexedHeap<int, std::greater<int>> maximum;
+	std::vector<size_t> live;
+	std::vector<int> values(4096, 0);
+	for(int round = 0; round < 20000; round++)
+	{
+		const unsigned action = random() % 4;
+		if(action == 0 || live.empty())
+		{
+			const int value = static_cast<int>(random() % 100000);
+			const size_t handle = maximum.push(value);
+			values[handle] = value;
+			live.push_back(handle);
+		}
+		else if(action == 1)
+		{
+			const size_t pick = random() % live.size();
+			const int value = static_cast<int>(random() % 100000);
+			maximum.update(live[pick], value);
+			values[live[pick]] = value;
+		}
+		else if(action == 2)
+		{
+			const size_t pick = random() % live.size();
+			const int erased = maximum.erase(live[pick]);
+			assert(erased == values[live[pick]]);
+			live[pick] = live.back();
+			live.pop_back();
+		}
+		else
+		{
+			int best = values[live[0]];
+			for(const size_t handle : live)
+				best = values[handle] > best ? values[handle] : best;
+			assert(maximum.top() == best);
+		}
+		assert(maximum.size() == live.size());
+	}
+
+	return 0;
+}
@@ -1,5 +1,6 @@
 #include "../../main/SLinkedList.h"
 #include <cassert>
+#include <memory>
 
 int main()
 {
@@ -52,5 +53,161 @@ int main()
 	assert(l1[1] == 2);
 	assert(l1[2] == 3);
 
+	SLinkedList<int> l2;
+	for(int i = 0; i < 100; i++)
+		l2.append(i);
+	for(size_t i = 0; i < l2.size(); i++)
+		assert(l2[i] == static_cast<int>(i));
+	assert(l2[50] == 50);
+	assert(l2[49] == 49);
+	l2.remove_at(10);
+	assert(l2[10] == 11);
+	assert(l2[9] == 9);
+	l2.insert_at(10, 10);
+	assert(l2[10] == 10);
+	assert(l2[11] == 11);
+	l2.prepend(-1);
+	assert(l2[0] == -1);
+	assert(l2[11] == 10);
+	l2.pop_back();
+	assert(l2[99] == 98);
+
+	l2.clear();
+	for(int i = 1; i <= 5; i++)
+		l2.append(i);
+	auto cursor = l2.cursor_at(2);
+	assert(*cursor == 3);
+	cursor.erase();
+	assert(*cursor == 4);
+	assert(l2.size() == 4);
+	assert(l2[2] == 4);
+	cursor.insert(3);
+	assert(*cursor == 4);
+	assert(cursor.index() == 3);
+	assert(l2[2] == 3);
+	++cursor;
+	++cursor;
+	assert(cursor.at_end());
+	cursor.insert(6);
+	assert(l2.back() == 6);
+	auto front = l2.cursor();
+	front.insert(0);
+	assert(l2.front() == 0);
+	front.erase();
+	assert(l2.front() == 0);
+	assert(l2[1] == 2);
+	front.insert(1);
+	assert(l2.size() == 7);
+	for(size_t i = 0; i < l2.size(); i++)
+		assert(l2[i] == static_cast<int>(i));
+	l2.pop_back();
+
+	SLinkedList<int> a;
+	SLinkedList<int> b;
+	for(int i = 0; i < 4; i++)
+		a.append(i);
+	for(int i = 10; i < 14; i++)
+		b.append(i);
+	a.splice(a.cursor_at(2), b);
+	assert(b.empty());
+	assert(a.size() == 8);
+	assert(a[1] == 1);
+	assert(a[2] == 10);
+	assert(a[5] == 13);
+	assert(a[6] == 2);
+	assert(a.back() == 3);
+
+	b.splice(b.cursor(), a, a.cursor_at(2), a.cursor_at(6));
+	assert(a.size() == 4);
+	assert(b.size() == 4);
+	for(size_t i = 0; i < a.size(); i++)
+		assert(a[i] == static_cast<int>(i));
+	for(size_t i = 0; i < b.size(); i++)
+		assert(b[i] == static_cast<int>(i) + 10);
+	assert(b.back() == 13);
+
+	a.splice(a.cursor_at(0), a, a.cursor_at(2), a.cursor_at(4));
+	assert(a[0] == 2);
+	assert(a[1] == 3);
+	assert(a[2] == 0);
+	assert(a.back() == 1);
+	a.splice(a.cursor_at(4), a, a.cursor_at(0), a.cursor_at(2));
+	assert(a[0] == 0);
+	assert(a.back() == 3);
+
+	SLinkedList<int> c = b.split_at(1);
+	assert(b.size() == 1);
+	assert(b.back() == 10);
+	assert(c.size() == 3);
+	assert(c.front() == 11);
+	assert(c.back() == 13);
+
+	a.concat(std::move(b));
+	a.concat(std::move(c));
+	assert(a.size() == 8);
+	assert(a[4] == 10);
+	assert(a.back() == 13);
+	SLinkedList<int> d = a.split_at(0);
+	assert(a.empty());
+	assert(d.size() == 8);
+	a.append(1);
+	assert(a.front() == 1);
+	assert(a.back() == 1);
+
+	SLinkedList<int> e;
+	for(int i = 0; i < 37; i++)
+		e.append((i * 17) % 37);
+	e.sort();
+	assert(e.size() == 37);
+	for(size_t i = 0; i < e.size(); i++)
+		assert(e[i] == static_cast<int>(i));
+	assert(e.back() == 36);
+	e.sort(std::greater<int>());
+	assert(e.front() == 36);
+	assert(e.back() == 0);
+	e.reverse();
+	assert(e.front() == 0);
+	assert(e.back() == 36);
+	for(size_t i = 0; i < e.size(); i++)
+		assert(e[i] == static_cast<int>(i));
+
+	SLinkedList<int> f;
+	for(int i = 0; i < 40; i += 2)
+		f.append(i);
+	e.merge(f);
+	assert(f.empty());
+	assert(e.size() == 57);
+	for(size_t i = 1; i < e.size(); i++)
+		assert(e[i - 1] <= e[i]);
+	assert(e.back() == 38);
+	const size_t duplicates = e.unique();
+	assert(duplicates == 19);
+	assert(e.size() == 38);
+	for(size_t i = 0; i < 37; i++)
+		assert(e[i] == static_cast<int>(i));
+	e.append(39);
+	assert(e.back() == 39);
+	e.pop_back();
+	assert(e.back() == 38);
+
+	SLinkedList<std::unique_ptr<int>> pointers;
+	pointers.append(std::make_unique<int>(1));
+	pointers.emplace_back(new int(2));
+	pointers.emplace_front(new int(0));
+	pointers.prepend(std::make_unique<int>(-1));
+	assert(pointers.size() == 4);
+	assert(*pointers.front() == -1);
+	assert(*pointers.back() == 2);
+	assert(*pointers[2] == 1);
+	std::unique_ptr<int> last = pointers.pop_back();
+	assert(*last == 2);
+	std::unique_ptr<int> first = pointers.pop_front();
+	assert(*first == -1);
+	pointers.sort([](const std::unique_ptr<int>& a, const std::unique_ptr<int>& b) { return *a > *b; });
+	assert(*pointers.front() == 1);
+	SLinkedList<std::unique_ptr<int>> moved = std::move(pointers);
+	assert(moved.size() == 2);
+	assert(pointers.empty());
+
 	return 0;
-}
\ No newline at end of file
+}
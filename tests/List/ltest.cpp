@@ -1,5 +1,6 @@
 #include "../../main/List.h"
 #include <cassert>
+#include <memory>
 
 int main()
 {
@@ -52,5 +53,14 @@ int main()
 	assert(l1[1] == 2);
 	assert(l1[2] == 3);
 
+	List<std::unique_ptr<int>> pointers;
+	pointers.append(std::make_unique<int>(1));
+	pointers.emplace_back(new int(2));
+	assert(pointers.size() == 2);
+	assert(*pointers[0] == 1);
+	assert(*pointers[1] == 2);
+	pointers.remove_at(0);
+	assert(*pointers[0] == 2);
+
 	return 0;
-}
\ No newline at end of file
+}
@@ -0,0 +1,80 @@
+#include "../../main/PriorityQueue.h"
+#include <cassert>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+int main()
+{
+	PriorityQueue<int> queue;
+	assert(queue.empty());
+	queue.push(3);
+	queue.push(7);
+	queue.emplace(5);
+	queue.push(1);
+	assert(queue.size() == 4);
+	assert(queue.top() == 7);
+	for(const int expected : { 7, 5, 3, 1 })
+	{
+		const int top = queue.pop();
+		assert(top == expected);
+	}
+	assert(queue.empty());
+	bool threw = false;
+	try
+	{
+		queue.pop();
+	}
+	catch(const std::out_of_range&)
+	{
+		threw = true;
+	}
+	assert(threw);
+
+	// Heapified from a range, popping has to give back a sorted sequence
+	std::vector<int> values;
+	for(int i = 0; i < 1000; i++)
+		values.push_back((i * 7919) % 1000);
+	PriorityQueue<int, std::greater<int>> minimum(values.begin(), values.end());
+	assert(minimum.size() == 1000);
+	for(int i = 0; i < 1000; i++)
+	{
+		const int top = minimum.pop();
+		assert(top == i);
+	}
+
+	PriorityQueue<int, std::less<int>, 4> quaternary(values);
+	for(int i = 0; i < 500; i++)
+		quaternary.push(i);
+	int previous = quaternary.pop();
+	while(!quaternary.empty())
+	{
+		const int current = quaternary.pop();
+		assert(current <= previous);
+		previous = current;
+	}
+
+	PriorityQueue<std::string> words{ "pear", "apple", "zucchini", "melon" };
+	assert(words.top() == "zucchini");
+	PriorityQueue<std::string> moved(std::move(words));
+	assert(words.empty());
+	const std::string first = moved.pop();
+	assert(first == "zucchini");
+	const std::string second = moved.pop();
+	assert(second == "pear");
+
+	PriorityQueue<std::unique_ptr<int>, std::function<bool(const std::unique_ptr<int>&, const std::unique_ptr<int>&)>> pointers(
+		[](const std::unique_ptr<int>& a, const std::unique_ptr<int>& b) { return *a < *b; });
+	pointers.push(std::make_unique<int>(2));
+	pointers.emplace(new int(9));
+	pointers.push(std::make_unique<int>(4));
+	assert(*pointers.top() == 9);
+	for(const int expected : { 9, 4, 2 })
+	{
+		const std::unique_ptr<int> top = pointers.pop();
+		assert(*top == expected);
+	}
+
+	return 0;
+}
@@ -0,0 +1,81 @@
+#include "../../main/Queue.h"
+#include <cassert>
+#include <memory>
+#include <vector>
+
+int main()
+{
+	Queue<int> queue;
+	assert(queue.empty());
+	queue.push(1);
+	queue.push(2);
+	queue.emplace(3);
+	assert(!queue.empty());
+	assert(queue.size() == 3);
+	assert(queue.peek() == 1);
+	const int first = queue.pop();
+	assert(first == 1);
+	const int second = queue.pop();
+	assert(second == 2);
+	assert(queue.size() == 1);
+	const int third = queue.pop();
+	assert(third == 3);
+	assert(queue.empty());
+
+	Queue<std::unique_ptr<int>> pointers;
+	pointers.push(std::make_unique<int>(1));
+	pointers.emplace(new int(2));
+	assert(*pointers.peek() == 1);
+	std::unique_ptr<int> front = pointers.pop();
+	assert(*front == 1);
+	front = pointers.pop();
+	assert(*front == 2);
+	assert(pointers.empty());
+
+	Queue<int> source{ 1, 2, 3 };
+	const int* front_address = &source.peek();
+	Queue<int> moved(std::move(source));
+	assert(source.empty());
+	assert(moved.size() == 3);
+	assert(&moved.peek() == front_address);
+
+	Queue<int> assigned{ 7 };
+	assigned = std::move(moved);
+	assert(moved.empty());
+	assert(assigned.size() == 3);
+	assert(&assigned.peek() == front_address);
+
+	Queue<int> other{ 8, 9 };
+	swap(assigned, other);
+	assert(assigned.size() == 2 && assigned.peek() == 8);
+	assert(other.size() == 3 && &other.peek() == front_address);
+	assigned.swap(other);
+	const int otherFront = other.pop();
+	assert(assigned.size() == 3 && otherFront == 8);
+
+	Queue<int> batch;
+	const std::vector<int> values{ 1, 2, 3, 4, 5 };
+	batch.push_range(values.begin(), values.end());
+	batch.push(6);
+	assert(batch.size() == 6);
+	assert(batch.peek() == 1);
+	int popped[4];
+	const size_t poppedCount = batch.pop_n(popped, 4);
+	assert(poppedCount == 4);
+	assert(popped[0] == 1 && popped[3] == 4);
+	assert(batch.peek() == 5);
+
+	List<int> drained;
+	batch.push_range(values.begin(), values.begin() + 2);
+	batch.drain_into(drained);
+	assert(batch.empty());
+	assert(drained.size() == 4);
+	assert(drained[0] == 5 && drained[1] == 6 && drained[2] == 1 && drained[3] == 2);
+	const size_t poppedNone = batch.pop_n(popped, 4);
+	assert(poppedNone == 0);
+	batch.push(7);
+	const int last = batch.pop();
+	assert(last == 7);
+
+	return 0;
+}
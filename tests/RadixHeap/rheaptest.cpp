@@ -0,0 +1,87 @@
+#include "../../main/RadixHeap.h"
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+int main()
+{
+	RadixHeap<uint32_t, std::string> heap;
+	assert(heap.empty());
+	heap.push(5, "five");
+	heap.push(1, std::string("one"));
+	heap.emplace(9, 3, 'n');
+	assert(heap.size() == 3);
+	assert(heap.top_key() == 1);
+	const std::string one = heap.pop();
+	assert(one == "one");
+	assert(heap.top_key() == 5);
+	const std::string five = heap.pop();
+	assert(five == "five");
+	heap.push(5, "again");
+	const std::string again = heap.pop();
+	assert(again == "again");
+	const std::string nine = heap.pop();
+	assert(nine == "nnn");
+	assert(heap.empty());
+	assert(heap.last_key() == 9);
+
+	bool threw = false;
+	try
+	{
+		heap.push(8, "late");
+	}
+	catch(const std::invalid_argument&)
+	{
+		threw = true;
+	}
+	assert(threw);
+	threw = false;
+	try
+	{
+		heap.pop();
+	}
+	catch(const std::out_of_range&)
+	{
+		threw = true;
+	}
+	assert(threw);
+
+	RadixHeap<int, int> negative;
+	negative.push(3, 3);
+	negative.push(-7, -7);
+	negative.push(-1, -1);
+	const int lowest = negative.pop();
+	assert(lowest == -7);
+	const int low = negative.pop();
+	assert(low == -1);
+	negative.push(0, 0);
+	const int zero = negative.pop();
+	assert(zero == 0);
+	const int three = negative.pop();
+	assert(three == 3);
+
+	// A simulation that schedules events after the current time, checked against sorting everything popped
+	std::mt19937_64 random(7);
+	RadixHeap<uint64_t, uint64_t> events;
+	uint64_t now = 0;
+	for(int i = 0; i < 1000; i++)
+		events.push(random() % 1000, 0);
+	std::vector<uint64_t> popped;
+	while(!events.empty() && popped.size() < 100000)
+	{
+		const uint64_t key = events.top_key();
+		assert(key >= now);
+		now = key;
+		events.pop();
+		popped.push_back(now);
+		if(popped.size() < 90000)
+			events.push(now + random() % (1 << 20), 0);
+	}
+	assert(std::is_sorted(popped.begin(), popped.end()));
+
+	return 0;
+}
@@ -0,0 +1,111 @@
+#include "../../main/ReadMostlyHashMap.h"
+#include <atomic>
+#include <cassert>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+int main()
+{
+	ReadMostlyHashMap<std::string, int> map;
+	assert(map.empty());
+	assert(!map.find("a"));
+	const bool insertedA = map.insert("a", 1);
+	assert(insertedA);
+	const bool insertedAgain = map.insert("a", 2);
+	assert(!insertedAgain);
+	assert(map.find("a") == 1);
+	map.insert_or_assign("a", 3);
+	map.insert_or_assign("b", 4);
+	assert(map.find(std::string_view("a")) == 3);
+	assert(map.size() == 2);
+	assert(map.contains_key("b"));
+
+	int seen = 0;
+	const bool foundB = map.find("b", [&](const int& value) { seen = value; });
+	assert(foundB && seen == 4);
+	const bool foundC = map.find("c", [&](const int&) { seen = -1; });
+	assert(!foundC && seen == 4);
+
+	// A batch is published at once, and a throwing batch not at all
+	const size_t inserted = map.modify([](HashMap<std::string, int>& copy)
+	{
+		copy.insert("c", 5);
+		copy.insert("d", 6);
+		return copy.size();
+	});
+	assert(inserted == 4 && map.size() == 4);
+	bool threw = false;
+	try
+	{
+		map.modify([](HashMap<std::string, int>& copy)
+		{
+			copy.insert("e", 7);
+			throw std::runtime_error("abandoned");
+		});
+	}
+	catch(const std::runtime_error&)
+	{
+		threw = true;
+	}
+	assert(threw);
+	assert(!map.contains_key("e") && map.size() == 4);
+
+	const bool removedA = map.remove("a");
+	assert(removedA);
+	const bool removedAgain = map.remove("a");
+	assert(!removedAgain);
+	assert(!map.contains_key("a"));
+	map.clear();
+	assert(map.empty());
+
+	// One writer rewrites every value in a batch while readers check that a snapshot never mixes two batches
+	constexpr int keys = 1000;
+	constexpr int batches = 200;
+	constexpr int readers = 6;
+	ReadMostlyHashMap<int, int> shared;
+	shared.modify([](HashMap<int, int>& copy)
+	{
+		for(int i = 0; i < keys; i++)
+			copy.insert(i, 0);
+	});
+
+	std::atomic<bool> done = false;
+	std::vector<std::thread> threads;
+	for(int r = 0; r < readers; r++)
+	{
+		threads.emplace_back([&shared, &done]
+		{
+			int last = 0;
+			while(!done.load())
+			{
+				const int version = *shared.find(0);
+				assert(version >= last);
+				last = version;
+				shared.read([](const HashMap<int, int>& snapshot)
+				{
+					const int first = snapshot.at(0);
+					for(int i = 1; i < keys; i++)
+						assert(snapshot.at(i) == first);
+				});
+			}
+		});
+	}
+	for(int b = 1; b <= batches; b++)
+	{
+		shared.modify([b](HashMap<int, int>& copy)
+		{
+			for(int i = 0; i < keys; i++)
+				copy.insert(i, b);
+		});
+	}
+	done = true;
+	for(std::thread& thread : threads)
+		thread.join();
+	assert(shared.find(keys - 1) == batches);
+	assert(shared.size() == keys);
+
+	return 0;
+}
@@ -0,0 +1,87 @@
+#include "../../main/SpscQueue.h"
+#include <cassert>
+#include <string>
+#include <thread>
+#include <vector>
+
+int main()
+{
+	SpscQueue<std::string, 4> queue;
+	assert(queue.empty());
+	assert(queue.peek() == nullptr);
+	std::string value;
+	const bool poppedEmpty = queue.pop(value);
+	assert(!poppedEmpty);
+
+	const bool pushedA = queue.push("a");
+	assert(pushedA);
+	const bool pushedB = queue.push(std::string("b"));
+	assert(pushedB);
+	const bool emplaced = queue.emplace(2, 'c');
+	assert(emplaced);
+	assert(queue.size() == 3);
+	assert(*queue.peek() == "a");
+	const bool poppedA = queue.pop(value);
+	assert(poppedA);
+	assert(value == "a");
+
+	const std::string batch[] = { "d", "e", "f" };
+	const size_t pushedBatch = queue.push_n(batch, 3);
+	assert(pushedBatch == 2);
+	assert(queue.size() == 4);
+	const bool pushedFull = queue.push("g");
+	assert(!pushedFull);
+
+	std::vector<std::string> out(8);
+	const size_t poppedBatch = queue.pop_n(out.begin(), 8);
+	assert(poppedBatch == 4);
+	assert(out[0] == "b");
+	assert(out[1] == "cc");
+	assert(out[2] == "d");
+	assert(out[3] == "e");
+	assert(queue.empty());
+	const bool pushedH = queue.push("h");
+	assert(pushedH);
+
+	constexpr size_t total = 200000;
+	SpscQueue<size_t, 1024> shared;
+	std::thread producer([&shared]
+	{
+		size_t next = 0;
+		size_t buffer[16];
+		while(next < total)
+		{
+			if(next % 3 == 0)
+			{
+				const size_t count = total - next < 16 ? total - next : 16;
+				for(size_t i = 0; i < count; i++)
+					buffer[i] = next + i;
+				next += shared.push_n(buffer, count);
+			}
+			else if(shared.push(next))
+				next++;
+		}
+	});
+
+	size_t expected = 0;
+	size_t buffer[32];
+	while(expected < total)
+	{
+		const size_t popped = shared.pop_n(buffer, 32);
+		for(size_t i = 0; i < popped; i++)
+		{
+			assert(buffer[i] == expected);
+			expected++;
+		}
+		size_t single;
+		if(shared.pop(single))
+		{
+			assert(single == expected);
+			expected++;
+		}
+	}
+	producer.join();
+	assert(shared.empty());
+
+	return 0;
+}
@@ -1,5 +1,7 @@
 #include "../../main/Stack.h"
 #include <cassert>
+#include <memory>
+#include <vector>
 
 int main()
 {
@@ -15,4 +17,126 @@ int main()
 	assert(stack.size() == 0);
 	assert(p == 5);
 	assert(stack.empty());
-}
\ No newline at end of file
+
+	Stack<std::unique_ptr<int>> pointers;
+	pointers.push(std::make_unique<int>(1));
+	pointers.emplace(new int(2));
+	assert(pointers.size() == 2);
+	assert(*pointers.peek() == 2);
+	std::unique_ptr<int> top = pointers.pop();
+	assert(*top == 2);
+	assert(pointers.size() == 1);
+	top = pointers.pop();
+	assert(*top == 1);
+	assert(pointers.empty());
+
+	Stack<int> source{ 1, 2, 3 };
+	const int* top_address = &source.peek();
+	Stack<int> moved(std::move(source));
+	assert(source.empty());
+	assert(moved.size() == 3);
+	assert(&moved.peek() == top_address);
+
+	Stack<int> assigned{ 7 };
+	assigned = std::move(moved);
+	assert(moved.empty());
+	assert(assigned.size() == 3);
+	assert(&assigned.peek() == top_address);
+
+	Stack<int> other{ 8, 9 };
+	swap(assigned, other);
+	assert(assigned.size() == 2 && assigned.peek() == 8);
+	assert(other.size() == 3 && &other.peek() == top_address);
+	assigned.swap(other);
+	assert(assigned.size() == 3 && other.size() == 2);
+
+	Stack<int> batch;
+	const std::vector<int> values{ 1, 2, 3, 4, 5 };
+	batch.push_range(values.begin(), values.end());
+	assert(batch.size() == 5);
+	assert(batch.peek() == 5);
+	int popped[3];
+	const size_t poppedFirst = batch.pop_n(popped, 3);
+	assert(poppedFirst == 3);
+	assert(popped[0] == 5 && popped[1] == 4 && popped[2] == 3);
+	assert(batch.size() == 2);
+	const size_t poppedRest = batch.pop_n(popped, 3);
+	assert(poppedRest == 2);
+	assert(popped[0] == 2 && popped[1] == 1);
+	assert(batch.empty());
+	const size_t poppedNone = batch.pop_n(popped, 3);
+	assert(poppedNone == 0);
+
+	batch.push_range(values.begin(), values.end());
+	List<int> drained;
+	drained.append(0);
+	batch.drain_into(drained);
+	assert(batch.empty());
+	assert(drained.size() == 6);
+	assert(drained[0] == 0 && drained[1] == 5 && drained[5] == 1);
+
+	Stack<std::unique_ptr<int>> movable;
+	movable.emplace(new int(1));
+	movable.emplace(new int(2));
+	List<std::unique_ptr<int>> owners;
+	movable.drain_into(owners);
+	assert(movable.empty());
+	assert(owners.size() == 2 && *owners[0] == 2 && *owners[1] == 1);
+
+	Stack<int, ArrayStorage> array{ 1, 2, 3 };
+	assert(array.size() == 3);
+	assert(array.peek() == 1);
+	array.push(4);
+	array.emplace(5);
+	assert(array.peek() == 5);
+	const int five = array.pop();
+	assert(five == 5);
+	const int four = array.pop();
+	assert(four == 4);
+	assert(array == (Stack<int, ArrayStorage>{ 1, 2, 3 }));
+	for(int i = 0; i < 1000; i++)
+		array.push(i);
+	for(int i = 999; i >= 0; i--)
+	{
+		const int value = array.pop();
+		assert(value == i);
+	}
+	assert(array.size() == 3);
+
+	array.push_range(values.begin(), values.end());
+	assert(array.peek() == 5);
+	const size_t arrayPopped = array.pop_n(popped, 3);
+	assert(arrayPopped == 3);
+	assert(popped[0] == 5 && popped[1] == 4 && popped[2] == 3);
+	List<int> arrayDrained;
+	array.drain_into(arrayDrained);
+	assert(array.empty());
+	assert(arrayDrained.size() == 5);
+	assert(arrayDrained[0] == 2 && arrayDrained[2] == 1 && arrayDrained[4] == 3);
+	bool threw = false;
+	try
+	{
+		array.pop();
+	}
+	catch(const std::out_of_range&)
+	{
+		threw = true;
+	}
+	assert(threw);
+
+	Stack<int, ArrayStorage> arrayCopy{ 7, 8 };
+	Stack<int, ArrayStorage> arrayMoved(std::move(arrayCopy));
+	assert(arrayCopy.empty() && arrayMoved.size() == 2 && arrayMoved.peek() == 7);
+	arrayCopy = arrayMoved;
+	assert(arrayCopy == arrayMoved);
+
+	Stack<std::unique_ptr<int>, ArrayStorage> arrayPointers;
+	arrayPointers.push(std::make_unique<int>(1));
+	arrayPointers.emplace(new int(2));
+	assert(*arrayPointers.peek() == 2);
+	top = arrayPointers.pop();
+	assert(*top == 2);
+	top = arrayPointers.pop();
+	assert(*top == 1);
+	assert(arrayPointers.empty());
+}
@@ -0,0 +1,81 @@
+#include "../../main/WorkStealingDeque.h"
+#include <atomic>
+#include <cassert>
+#include <thread>
+#include <vector>
+
+int main()
+{
+	WorkStealingDeque<int> deque(4);
+	assert(deque.empty());
+	int value;
+	const bool poppedEmpty = deque.pop(value);
+	assert(!poppedEmpty);
+	const bool stoleEmpty = deque.steal(value);
+	assert(!stoleEmpty);
+
+	for(int i = 0; i < 10; i++)
+		deque.push(i);
+	assert(deque.size() == 10);
+	assert(deque.capacity() == 16);
+	const bool poppedNine = deque.pop(value);
+	assert(poppedNine && value == 9);
+	const bool stoleZero = deque.steal(value);
+	assert(stoleZero && value == 0);
+	const bool stoleOne = deque.steal(value);
+	assert(stoleOne && value == 1);
+	for(int i = 8; i >= 2; i--)
+	{
+		const bool popped = deque.pop(value);
+		assert(popped && value == i);
+	}
+	assert(deque.empty());
+	const bool poppedDrained = deque.pop(value);
+	assert(!poppedDrained);
+	deque.push(42);
+	const bool stoleLast = deque.steal(value);
+	assert(stoleLast && value == 42);
+	const bool poppedStolen = deque.pop(value);
+	assert(!poppedStolen);
+
+	// The owner pushes and pops while thieves steal, every element has to be taken exactly once
+	constexpr int total = 200000;
+	constexpr int thieves = 3;
+	WorkStealingDeque<int> shared;
+	std::vector<std::atomic<int>> taken(total);
+	std::atomic<bool> done(false);
+
+	std::vector<std::thread> threads;
+	for(int i = 0; i < thieves; i++)
+	{
+		threads.emplace_back([&]
+		{
+			int stolen;
+			while(!done.load(std::memory_order_acquire) || !shared.empty())
+			{
+				if(shared.steal(stolen))
+					taken[stolen].fetch_add(1, std::memory_order_relaxed);
+				else
+					std::this_thread::yield();
+			}
+		});
+	}
+
+	int popped;
+	for(int i = 0; i < total; i++)
+	{
+		shared.push(i);
+		if(i % 3 == 0 && shared.pop(popped))
+			taken[popped].fetch_add(1, std::memory_order_relaxed);
+	}
+	while(shared.pop(popped))
+		taken[popped].fetch_add(1, std::memory_order_relaxed);
+	done.store(true, std::memory_order_release);
+	for(std::thread& thread : threads)
+		thread.join();
+
+	for(int i = 0; i < total; i++)
+		assert(taken[i].load() == 1);
+
+	return 0;
+}